@@ -23,6 +23,7 @@ class DirectPosition
   DirectPosition(double x = 0.0, double y = 0.0) : itsArr(x, y) {}
   DirectPosition(const DoubleArr& da) : itsArr(da) {}
   DoubleArr& getCoordinates() { return itsArr; }
+  const DoubleArr& getCoordinates() const { return itsArr; }
   const double& getX() const { return itsArr.getX(); }
   const double& getY() const { return itsArr.getY(); }
 
@@ -75,6 +76,7 @@ class BezSeg
   DoubleArr getTangent(double t);
   DoubleArr getRotatedUnitVector(DoubleArr p1, DoubleArr p2, double rotationAngleInDegrees);
   double getSegmentLength();
+  double getParameter(double arcLength);
   void isSecondLastSegment(boolean yesOrNo);
   boolean isSecondLastSegment();
   void isLastSegment(boolean yesOrNo);
@@ -87,7 +89,7 @@ class BezSeg
 
   int segmentIndex;
   double segmentLength;
-  std::vector<DirectPosition> curvePositions;
+  int curvePositionCount;  // Number of curve positions the segment was created from
 
   DoubleArr start;
   DoubleArr end;
@@ -103,11 +105,17 @@ class BezSeg
   static constexpr double dt = 0.04;  // Bézier segment evalation step [0..1]
   double tightness;
 
+  // Cumulative arc lengths at t = i / arcLengthSamples
+  static const int arcLengthSamples = 16;
+  double arcLengths[arcLengthSamples + 1];
+
   boolean isChanged();
-  void computeGeometry();
-  void computeSegmentPointPositions();
+  void computeGeometry(const std::vector<DirectPosition>& curvePositions);
+  void computeSegmentPointPositions(const std::vector<DirectPosition>& curvePositions);
   DoubleArr createControlPoint(DoubleArr& a, DoubleArr& b, DoubleArr& c, int direction);
   void computeSegmentLength();
+  double getSpeed(double t);
+  double getArcLength(double t0, double t1);
 };
 
 }  // namespace frontier
@@ -11,9 +11,23 @@
 
 #include "BezSeg.h"
 #include <list>
+#include <random>
+#include <vector>
 
 namespace frontier
 {
+// Random number generator for curve decoration. The generator is owned and seeded by the
+// caller, making the output reproducible
+
+typedef std::mt19937 RandomGenerator;
+
+// Random number in range [0,1)
+
+inline double uniformRandom(RandomGenerator& rng)
+{
+  return rng() / (RandomGenerator::max() + 1.0);
+}
+
 class BezierModel
 {
   // Ref [1].
@@ -37,7 +51,7 @@ class BezierModel
   void addCurvePosition(DirectPosition curvePosition, boolean isClosedCurve);
   double getCumulatedCurveLength(int i);
   const std::vector<DirectPosition>& getCurvePositions();
-  const std::list<BezSeg>& getBezierSegments();
+  const std::vector<BezSeg>& getBezierSegments();
   int getBezierSegmentCount();
   DirectPosition getStartPointOfLastBezierSegment();
   DirectPosition getEndPointOfLastBezierSegment();
@@ -67,21 +81,36 @@ class BezierModel
   int getSteppedCurvePoints(unsigned int baseStep,
                             unsigned int maxRand,
                             unsigned int maxRepeat,
-                            std::list<DirectPosition>& curvePoints);
+                            std::list<DirectPosition>& curvePoints,
+                            RandomGenerator& rng);
+  int getSteppedCurvePoints(unsigned int baseStep,
+                            unsigned int maxRand,
+                            unsigned int maxRepeat,
+                            std::vector<DirectPosition>& curvePoints,
+                            RandomGenerator& rng);
   void decorateCurve(std::list<DirectPosition>& curvePoints,
                      bool negative,
                      int scaleHeightMin,
                      int scaleHeightRandom,
                      int controlMin,
                      int controlRandom,
-                     std::list<DoubleArr>& decoratorPoints);
+                     std::list<DoubleArr>& decoratorPoints,
+                     RandomGenerator& rng);
+  void decorateCurve(const std::vector<DirectPosition>& curvePoints,
+                     bool negative,
+                     int scaleHeightMin,
+                     int scaleHeightRandom,
+                     int controlMin,
+                     int controlRandom,
+                     std::vector<DoubleArr>& decoratorPoints,
+                     RandomGenerator& rng);
 
  private:
-  std::vector<DirectPosition> curvePositions;
-  std::list<BezSeg> bezierSegments;
+  std::vector<DirectPosition> curvePositions;  // Curve positions shared by all segments
+  std::vector<BezSeg> bezierSegments;
   Orientation orientation;
   double totalCurveLength;
-  std::list<double> cumulatedCurveLength;
+  std::vector<double> cumulatedCurveLength;
   boolean bIsClosedCurve;
   double tightness;
 };
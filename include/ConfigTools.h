@@ -9,8 +9,10 @@
 
 #include <libconfig.h++>
 
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 #include <typeinfo>
 
@@ -131,6 +133,72 @@ std::string type_name()
   return type_names<T,T>();
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Check if setting's type matches the value type
+ *
+ *		The check follows libconfig's type conversion rules (no automatic
+ *		conversion between numeric types).
+ */
+// ----------------------------------------------------------------------
+
+template <typename T>
+inline bool type_match(const libconfig::Setting& setting)
+{
+  if (std::is_floating_point<T>::value)
+    return (setting.getType() == libconfig::Setting::TypeFloat);
+
+  return (setting.getType() == ((sizeof(T) > sizeof(int)) ? libconfig::Setting::TypeInt64
+                                                           : libconfig::Setting::TypeInt));
+}
+
+template <>
+inline bool type_match<bool>(const libconfig::Setting& setting)
+{
+  return (setting.getType() == libconfig::Setting::TypeBoolean);
+}
+
+template <>
+inline bool type_match<std::string>(const libconfig::Setting& setting)
+{
+  return (setting.getType() == libconfig::Setting::TypeString);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Read an optional configuration value without throwing
+ *
+ *		Returns unset value if the setting does not exist or has wrong type;
+ *		'typeMismatch' (if available) is set if the setting exists but has
+ *		wrong type.
+ */
+// ----------------------------------------------------------------------
+
+template <typename T>
+std::optional<T> lookup_optional(const libconfig::Setting& setting,
+                                 const std::string& name,
+                                 bool* typeMismatch = nullptr)
+{
+  if (typeMismatch)
+    *typeMismatch = false;
+
+  if (!setting.exists(name))
+    return std::nullopt;
+
+  const libconfig::Setting& value = setting[name.c_str()];
+
+  if (!type_match<T>(value))
+  {
+    if (typeMismatch)
+      *typeMismatch = true;
+
+    return std::nullopt;
+  }
+
+  T ret = value;
+  return ret;
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Read a configuration value with proper error messages
@@ -165,39 +233,26 @@ T lookup(const libconfig::Setting& setting,
   // 'isSet' flag (if available) is set to false.
   //
   // If specific ('s_base' + n) setting is not found, SettingIdNotFoundException is thrown.
+  //
+  // If the setting has wrong type, libconfig::SettingTypeException is thrown.
 
-  T ret = T();
   bool bSet;
   bool* _isSet = &bSet;
   bool** pSet = (isSet ? &isSet : &_isSet);
   std::string prefixName(prefix.empty() ? name : (prefix + "." + name));
 
-  // lookupValue throws on missing setting etc, even though it shouldn't ?
+  // Check for missing setting without throwing; lookupValue throws and catches internally
 
-  try
-  {
-    **pSet = setting.lookupValue(name, ret);
-  }
-  catch (const libconfig::SettingNotFoundException&)
-  {
-    **pSet = false;
-  }
-  catch (const libconfig::SettingTypeException&)
-  {
-    throw;
-  }
-  catch (const libconfig::ParseException&)
-  {
-    throw std::runtime_error("Failed to parse value of '" + prefixName + "' as type " +
-                             type_name<T>());
-  }
-  catch (...)
-  {
-    throw std::runtime_error("Failed to get value of '" + prefixName + "'");
-  }
+  bool typeMismatch;
+  std::optional<T> ret = lookup_optional<T>(setting, name, &typeMismatch);
+
+  if (typeMismatch)
+    throw libconfig::SettingTypeException(setting[name.c_str()]);
+
+  **pSet = ret.has_value();
 
   if (**pSet || (settingId == s_optional))
-    return ret;
+    return ret.value_or(T());
 
   if (settingId == s_required)
     throw std::runtime_error("Setting for " + prefixName + " is missing");
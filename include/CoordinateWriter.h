@@ -0,0 +1,98 @@
+// ======================================================================
+/*!
+ * \brief frontier::CoordinateWriter
+ *
+ * Formats coordinates (fixed notation with given number of decimals)
+ * and path syntax into a reusable character buffer. Used instead of
+ * ostreams when emitting large amounts of coordinates, e.g. for SVG
+ * path data.
+ *
+ * Path data written with moveTo(), lineTo() etc. is encoded either
+ * with absolute commands (M x,y L x,y ...), or in compact form using
+ * relative commands (m/l/q/c/z), trimmed numbers (no trailing zeros
+ * or leading zero of fractions) and separators only where needed.
+ * In compact mode coordinates are rounded to the precision before
+ * taking the differences, so errors do not accumulate.
+ */
+// ======================================================================
+
+#ifndef FRONTIER_COORDINATEWRITER_H
+#define FRONTIER_COORDINATEWRITER_H
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace frontier
+{
+class CoordinateWriter
+{
+ public:
+  enum Encoding
+  {
+    Absolute,
+    Compact
+  };
+
+  explicit CoordinateWriter(int thePrecision = 1, Encoding theEncoding = Absolute);
+
+  int precision() const { return itsPrecision; }
+  void precision(int thePrecision);
+
+  Encoding encoding() const { return itsEncoding; }
+  void encoding(Encoding theEncoding) { itsEncoding = theEncoding; }
+
+  void clear();
+  bool empty() const { return (itsBuffer.size() == 0); }
+
+  CoordinateWriter& operator<<(double theValue);
+  CoordinateWriter& operator<<(char theChar);
+  CoordinateWriter& operator<<(const char* theText);
+  CoordinateWriter& operator<<(const std::string& theText);
+
+  void beginPath();
+  void moveTo(double x, double y);
+  void lineTo(double x, double y);
+  void quadTo(double x1, double y1, double x, double y);
+  void curveTo(double x1, double y1, double x2, double y2, double x, double y);
+  void closePath();
+
+  const char* data() const { return itsBuffer.data(); }
+  std::size_t size() const { return itsBuffer.size(); }
+  std::string str() const { return fmt::to_string(itsBuffer); }
+
+ private:
+  enum NumberState
+  {
+    NoNumber,
+    IntegerNumber,
+    DecimalNumber
+  };
+
+  void command(char theCommand);
+  void coordinate(double x, double y);
+  void number(double theValue);
+  double round(double theValue) const;
+
+  fmt::memory_buffer itsBuffer;
+  int itsPrecision;
+  double itsScale;
+  Encoding itsEncoding;
+
+  char itsCommand;            // Last path command written
+  NumberState itsLastNumber;  // Type of the last compact number written
+  double itsX, itsY;          // Current (rounded) point for relative commands
+  double itsStartX, itsStartY;
+
+};  // class CoordinateWriter
+
+inline std::ostream& operator<<(std::ostream& theOutput, const CoordinateWriter& theWriter)
+{
+  return theOutput.write(theWriter.data(), theWriter.size());
+}
+
+}  // namespace frontier
+
+#endif  // FRONTIER_COORDINATEWRITER_H
@@ -7,10 +7,9 @@
 #ifndef FRONTIER_CUBICBEZIER_H
 #define FRONTIER_CUBICBEZIER_H
 
-#include "NFmiFillMap.h"
 #include "Point.h"
-#include "clipper.hpp"
 #include <utility>
+#include <vector>
 
 namespace frontier
 {
@@ -22,10 +21,10 @@ class CubicBezier
       double x1, double y1, double x2, double y2, double x3, double y3, double x4, double y4);
 
   double length(double eps = 0.001,
-                NFmiFillMap* fmap = nullptr,
-                double* lastx = nullptr,
-                double* lasty = nullptr,
-                ClipperLib::Path* path = nullptr) const;
+                std::vector<Point>* points = nullptr,
+                std::vector<double>* lengths = nullptr,
+                double offset = 0,
+                double tolerance = 0) const;
   std::pair<CubicBezier, CubicBezier> split() const;
 
  private:
@@ -0,0 +1,40 @@
+// ======================================================================
+/*!
+ * \brief frontier::ElevationScale
+ *
+ * Piecewise linear mapping of elevations to relative [0,1] positions
+ * on the elevation axis. The breakpoints are stored in contiguous
+ * arrays together with the precalculated interpolation factors, and
+ * the interval for an elevation is found by binary search.
+ */
+// ======================================================================
+
+#ifndef FRONTIER_ELEVATIONSCALE_H
+#define FRONTIER_ELEVATIONSCALE_H
+
+#include <cstddef>
+#include <vector>
+
+namespace frontier
+{
+class ElevationScale
+{
+ public:
+  void clear();
+  void add(double theElevation, double theScale);
+
+  bool empty() const { return itsElevations.empty(); }
+  std::size_t size() const { return itsElevations.size(); }
+
+  double scale(double theElevation) const;
+
+ private:
+  std::vector<double> itsElevations;  // Breakpoint elevations in rising order
+  std::vector<double> itsScales;      // Relative position of the breakpoints
+  std::vector<double> itsFactors;     // Factor for interpolation to the next breakpoint
+
+};  // class ElevationScale
+
+}  // namespace frontier
+
+#endif  // FRONTIER_ELEVATIONSCALE_H
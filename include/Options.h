@@ -49,6 +49,10 @@ class Options
 
   std::string locale;
 
+  // --seed; random seed for curve decorations, defaults to 0
+
+  unsigned int seed;
+
 };  // class Options
 
 bool parse_options(int argc, char* argv[], Options& theOptions);
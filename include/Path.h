@@ -11,6 +11,10 @@
  * The path object is not designed for editing, only for storing
  * a path, calculating its length and producing the respective
  * SVG path cdata.
+ *
+ * The curves are flattened into a polyline on first use; the polyline
+ * is shared by length calculation, fill map building, scaling and
+ * nearest vertex search, and is discarded when the path is modified.
  */
 // ======================================================================
 
@@ -19,12 +23,14 @@
 
 #include "NFmiFillMap.h"
 
+#include <cstddef>
 #include <string>
 #include <utility>
 #include <vector>
 
 namespace frontier
 {
+class CoordinateWriter;
 class PathTransformation;
 
 class Path
@@ -37,10 +43,16 @@ class Path
 
   Path& operator+=(const Path& path);
 
+  // Reserve room for given number of path elements and points (coordinate pairs)
+  void reserve(std::size_t elementCount, std::size_t pointCount);
+
   bool empty() const;
   double length(NFmiFillMap* fmap = nullptr) const;
-  std::string svg() const;
+  std::string svg(int precision = 1) const;
+  void svg(CoordinateWriter& writer) const;
   void transform(const PathTransformation& transformation);
+  void simplify(double tolerance);
+  void clip(double xmin, double ymin, double xmax, double ymax);
   bool scale(double offset, Path& scaledPath) const;
 
   std::pair<double, double> nearestVertex(double x, double y) const;
@@ -59,11 +71,44 @@ class Path
   BBox getBBox() const;
 
  private:
-  typedef std::vector<double> PathData;
-  PathData pathdata;
+  // Path elements and their points (x,y pairs; 1 point for moveto and lineto, 3 for curveto)
+  typedef std::vector<unsigned char> PathElements;
+  typedef std::vector<double> PathCoordinates;
+  PathElements elements;
+  PathCoordinates coordinates;
+
+  // Flattened path. Subpath start and line vertices are polyline points; pen positions
+  // (after closepath and curveto) only set the start point for the next line
+  enum FlatType
+  {
+    SubPathStart,
+    LineVertex,
+    PenPosition
+  };
+  struct FlatPoint
+  {
+    FlatPoint(double theX, double theY, double theLength, FlatType theType)
+        : x(theX), y(theY), length(theLength), type(theType)
+    {
+    }
+    double x;
+    double y;
+    double length;  // Cumulative arc length
+    FlatType type;
+  };
+  typedef std::vector<FlatPoint> FlatData;
+  mutable FlatData flatdata;
+  mutable double flatlength = 0;
+  mutable bool flattened = false;
 
-  void clear() { pathdata.clear(); }
-  void walk(size_t i, BBox& bbox, double x, double y) const;
+  const FlatData& flatten() const;
+  void invalidate();
+  void clear()
+  {
+    elements.clear();
+    coordinates.clear();
+    invalidate();
+  }
 
 };  // class Path
 
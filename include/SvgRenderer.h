@@ -8,6 +8,9 @@
 #define FRONTIER_SVGRENDERER_H
 
 #include "BezSeg.h"
+#include "BezierModel.h"
+#include "CoordinateWriter.h"
+#include "ElevationScale.h"
 #include "Options.h"
 #include "Path.h"
 
@@ -24,8 +27,14 @@
 #include <libconfig.h++>
 
 #include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <optional>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 class NFmiArea;
 class NFmiQueryData;
@@ -97,7 +106,7 @@ class AxisManager
   double scaledElevation(double elevation,
                          bool *above = nullptr,
                          double belowZero = 50.0,
-                         double aboveTop = 100.0);
+                         double aboveTop = 100.0) const;
 
   // Min elevation value to be taken as nonzero
   double nonZeroElevation() { return 10.0; }
@@ -111,6 +120,7 @@ class AxisManager
   Fmi::TimePeriod itsTimePeriod;
 
   std::list<Elevation> itsElevations;
+  ElevationScale itsElevationScale;
 };
 
 class ConfigGroup
@@ -146,6 +156,7 @@ class ConfigGroup
   const std::string &markerPlaceHolder() const { return itsMarkerPlaceHolder; }
   bool standalone() const { return itsStandalone; }
   bool contains(const std::string &theMemberType, bool only = false) const;
+  std::vector<std::string> types() const;
   void addType(const std::string &type) const;
   std::string memberTypes(bool allTypes = false) const;
 
@@ -316,8 +327,18 @@ class GroupCategory : public CategoryValueMeasureGroup
   std::string groupLabel() const;
 
  private:
+  typedef typename std::list<T>::const_iterator GroupIterator;
+
+  void compileTypes() const;
+  GroupIterator typeGroup(const std::string &theMemberType) const;
+
   typename std::list<T> itsGroups;
   typename std::list<T>::const_iterator itcg;
+
+  // Member types and the first group containing them; compiled on first use since
+  // the groups are loaded after construction
+  mutable bool isCompiled;
+  mutable std::unordered_map<std::string, GroupIterator> itsTypeGroups;
 };
 
 typedef GroupCategory<CloudGroup> CloudGroupCategory;
@@ -403,6 +424,45 @@ class ElevationGroupItem
 
 typedef std::list<ElevationGroupItem> ElevGrp;
 
+// Elevation ranges of a group of elevations indexed by time instant. The ranges of each time
+// instant are stored in the group's order, and are also sorted by lo range for overlap queries.
+// The index must be rebuilt if elevations are added to or removed from the group
+
+class ElevationIndex
+{
+ public:
+  struct Range
+  {
+    ElevGrp::iterator iteg;
+    double lo;
+    double hi;
+  };
+
+  explicit ElevationIndex(ElevGrp &eGrp);
+
+  // Ranges in group's order
+  size_t size() const { return itsRanges.size(); }
+  const Range &operator[](size_t theIndex) const { return itsRanges[theIndex]; }
+  // Time instants and their ranges [timeBegin,timeEnd)
+  size_t timeCount() const { return itsTimes.size() - 1; }
+  const Fmi::DateTime &validTime(size_t theTime) const;
+  // Time instant of the given valid time; the group must have elevations for the time
+  size_t timeIndex(const Fmi::DateTime &theValidTime) const;
+  size_t timeBegin(size_t theTime) const { return itsTimes[theTime]; }
+  size_t timeEnd(size_t theTime) const { return itsTimes[theTime + 1]; }
+  // Time instant 1 hour before the given time instant (if any)
+  std::optional<size_t> previousTime(size_t theTime) const;
+  // Time instant 1 hour after the given time instant (if any)
+  std::optional<size_t> nextTime(size_t theTime) const;
+  // Ranges of the time instant overlapping [lo,hi], in group's order
+  void overlapping(size_t theTime, double lo, double hi, std::vector<size_t> &theRanges) const;
+
+ private:
+  std::vector<Range> itsRanges;
+  std::vector<size_t> itsTimes;    // Index of the first range of each time instant, and size()
+  std::vector<size_t> itsLoOrder;  // Range indexes of each time instant sorted by lo range
+};
+
 struct ElevationHole
 {
   ElevationHole()
@@ -458,6 +518,135 @@ typedef struct
 } FillAreaData;
 typedef std::map<std::string, FillAreaData> FillAreas;  // Marker name and related fill areas
 
+// Precompiled configuration blocks for list type settings (Surface, Symbol, Text etc.)
+
+struct ConfigBlock
+{
+  const libconfig::Setting *specs;
+  bool hasName;        // Global blocks have no name
+  std::string name;    // Block's name
+  std::string locale;  // Block's locale (lowercase), empty if not set
+};
+typedef std::vector<ConfigBlock> ConfigBlocks;
+
+struct ConfigScope
+{
+  std::list<const libconfig::Setting *> scope;  // Global blocks and the current block (as the
+                                                // last element) in the order of appearance
+  int nameIdx;                                  // Index of the block with matching name or -1
+};
+
+// Resolved settings of a conseptual model symbol
+struct SymbolSpec
+{
+  bool found;             // Set if the settings (and symbol code) were found
+  int symbolIdx;          // Index of the last block with matching name or -1
+  int localeIdx;          // Index of the block with matching locale or -1
+  bool hasLocaleGlobals;  // Set if there are blocks with matching name but no locale
+  std::list<const libconfig::Setting *> scope;  // Global blocks and the current block
+  std::string code;                             // Symbol code
+  std::string folder;                           // Symbol folder
+  std::string type;                             // svg, img or font
+  int xoffset;
+  int yoffset;
+  std::string placeHolder;  // Output placeholder; empty for the passed stream
+  std::string uri;          // Image url (%folder% and %symbol% replaced) or empty for 'use'
+  std::string classDef;     // 'use' class
+  bool hasScale;
+  double scale;
+  bool hasWidth;
+  bool hasHeight;
+  int width;
+  int height;
+  std::string class1;  // Font symbol classes
+  std::string class2;  // Font symbol specific class
+};
+
+// Template's CSS class properties; pixel values (e.g. font-size) converted to numbers, nullopt
+// for values in other units
+typedef std::unordered_map<std::string, std::unordered_map<std::string, std::optional<double> > >
+    CssClasses;
+
+// Precompiled conditions of a conditions list. Numeric conditions are stored into value sorted
+// tables and hh[:mm]-hh[:mm] time ranges into a table of time of day segments, each having the
+// indexes of the matching conditions
+
+class ConditionTable
+{
+ public:
+  ConditionTable(const libconfig::Setting &theCondSpecs,
+                 const std::string &theConfPath,
+                 const std::string &theClassName);
+
+  const libconfig::Setting *match(double theValue, const std::string &theParameter = "");
+  const libconfig::Setting *match(const Fmi::DateTime &theValue,
+                                  const std::string &theParameter = "");
+  const libconfig::Setting *match(const std::string &theValue,
+                                  const std::string &theParameter = "");
+
+ private:
+  ConditionTable();
+
+  void compileNumeric();
+  void compileTimeRanges();
+  void compileStrings();
+
+  struct Bound
+  {
+    double value;
+    int idx;
+  };
+  typedef std::vector<Bound> Bounds;
+
+  const libconfig::Setting &itsCondSpecs;
+  std::string itsConfPath;
+  std::string itsClassName;
+
+  // Numeric conditions
+  bool hasNumeric;
+  int itsEqNanIdx;
+  Bounds itsEq;
+  Bounds itsLe;
+  Bounds itsLt;
+  Bounds itsGe;
+  Bounds itsGt;
+
+  // Time ranges; segment start times (seconds of day) and matching conditions
+  bool hasTimeRanges;
+  std::vector<int> itsSegments;
+  std::vector<std::vector<int> > itsSegmentConds;
+
+  // String conditions (lowercase value and the index of the first matching condition)
+  bool hasStrings;
+  std::unordered_map<std::string, int> itsStrings;
+};
+
+class ConfigResolver
+{
+ public:
+  ConfigResolver(const libconfig::Config &theConfig, const std::string &theLocale);
+
+  // Configuration blocks for given path; nullptr if the path does not exist
+  const ConfigBlocks *blocks(const std::string &theConfPath);
+  // Active scope for given path and block name; nullptr if the path does not exist
+  const ConfigScope *scope(const std::string &theConfPath,
+                           const std::string &theName,
+                           bool localeBlocks = false);
+  // Conditions for given path and block index; nullptr if the conditions do not exist
+  ConditionTable *conditions(const std::string &theConfPath,
+                             const std::string &theClassName,
+                             int theSpecsIdx);
+
+ private:
+  ConfigResolver();
+
+  const libconfig::Config &itsConfig;
+  std::string itsLocale;
+  std::unordered_map<std::string, std::optional<ConfigBlocks> > itsBlocks;
+  std::unordered_map<std::string, ConfigScope> itsScopes;
+  std::unordered_map<std::string, std::shared_ptr<ConditionTable> > itsConditions;
+};
+
 class SvgRenderer : public woml::FeatureVisitor
 {
  public:
@@ -521,6 +710,10 @@ class SvgRenderer : public woml::FeatureVisitor
                      const std::string &regionId,
                      const std::string &creator);
 
+  // Features to be rendered. Elevation grouping of aerodrome time series features is done
+  // concurrently when rendering the first aerodrome feature
+  void features(const std::list<const woml::Feature *> &theFeatures);
+
   std::string svg() const;
 
  private:
@@ -528,10 +721,20 @@ class SvgRenderer : public woml::FeatureVisitor
 
   bool hasCssClass(const std::string &theCssClass) const;
 
+  bool outsideArea(const std::optional<Path::BBox> &bbox);
+  bool outsideArea(double lon, double lat);
+  void clipToArea(Path &path) const;
+  CoordinateWriter &pathWriter(int defaultPrecision);
+  const CoordinateWriter &svgPath(const Path &path);
+
   double getCssSize(const std::string &theCssClass,
                     const std::string &theAttribute,
                     double defaultValue = 30);
   template <typename T>
+  T getSetting(const std::string &theConfigClass,
+               const std::string &theAttribute,
+               T theDefaultValue);
+  template <typename T, typename T2>
   T getSetting(const std::string &theConfigClass,
                const std::string &theAttribute,
                T theDefaultValue);
@@ -590,6 +793,13 @@ class SvgRenderer : public woml::FeatureVisitor
                      const std::list<std::string> *areaSymbols = nullptr,
                      int width = 0,
                      int height = 0);
+  const SymbolSpec *symbolSpec(const std::string &confPath,
+                               const std::string &symClass,
+                               const std::string &symCode,
+                               const woml::NumericalSingleValueMeasure *svm,
+                               bool fill,
+                               bool areaSymbols,
+                               bool hasSize);
   void render_value(const std::string &path,
                     std::ostringstream &valOutput,
                     const std::string &valClass,
@@ -624,22 +834,14 @@ class SvgRenderer : public woml::FeatureVisitor
                                     bool join = true,
                                     bool getHole = false,
                                     CategoryValueMeasureGroup *categoryGroup = nullptr);
-  unsigned int getLeftSideGroupNumber(ElevGrp &eGrp,
-                                      ElevGrp::iterator &iteg,
-                                      unsigned int nextGroupNumber,
-                                      bool mixed = true);
-  unsigned int getRightSideGroupNumber(ElevGrp &eGrp,
-                                       ElevGrp::reverse_iterator &itegrev,
-                                       unsigned int groupNumber,
-                                       bool mixed = true);
   void setGroupNumbers(const std::list<woml::TimeSeriesSlot> &ts, bool mixed = true);
-  void checkLeftSide(ElevGrp &eGrp,
+  void checkLeftSide(const ElevationIndex &index,
                      ElevationHole &hole,
                      CategoryValueMeasureGroup *groupCategory = nullptr);
   bool checkLeftSideHoles(ElevationHoles &holes,
                           ElevationHoles::iterator &iteh,
                           CategoryValueMeasureGroup *groupCategory = nullptr);
-  void checkRightSide(ElevGrp &eGrp,
+  void checkRightSide(const ElevationIndex &index,
                       ElevationHoles::iterator &iteh,
                       CategoryValueMeasureGroup *groupCategory = nullptr);
   bool checkRightSideHoles(ElevationHoles &holes,
@@ -649,6 +851,7 @@ class SvgRenderer : public woml::FeatureVisitor
                           ElevationHoles::iterator &iteh,
                           CategoryValueMeasureGroup *groupCategory = nullptr);
   bool checkHoles(ElevGrp &eGrp,
+                  const ElevationIndex &index,
                   ElevationHoles &holes,
                   CategoryValueMeasureGroup *groupCategory = nullptr,
                   bool setNegative = true);
@@ -667,6 +870,12 @@ class SvgRenderer : public woml::FeatureVisitor
   template <typename T>
   void render_aerodrome(const T &theFeature);
   void render_aerodromeFrame(const Fmi::TimePeriod &theTimePeriod);
+  void prepareAerodrome();
+  std::shared_ptr<CategoryValueMeasureGroup> loadCloudGroupCategory(std::set<size_t> &cloudSet);
+  template <typename GroupCategoryT, typename GroupTypeT>
+  std::shared_ptr<CategoryValueMeasureGroup> loadGroupCategory(const std::string &confPath,
+                                                               std::set<size_t> &memberSet);
+  bool preparedTimeserie(const std::list<woml::TimeSeriesSlot> &ts, bool &hasHole);
   void render_elevationAxis();
   void render_timeAxis(const Fmi::TimePeriod &theTimePeriod);
   const libconfig::Setting &cloudLayerConfig(const std::string &confPath,
@@ -728,6 +937,12 @@ class SvgRenderer : public woml::FeatureVisitor
   void render_timeserie(const woml::MigratoryBirds &migratorybirds);
   void render_timeserie(const woml::SurfaceVisibility &surfacevisibility);
   void render_timeserie(const woml::SurfaceWeather &surfaceweather);
+  const std::string &windArrowSymbol(const std::string &href,
+                                     const std::string &classDef,
+                                     double scale,
+                                     unsigned int arrowArmLength,
+                                     double windDirection,
+                                     std::ostringstream &defs);
   void render_timeserie(const woml::Winds &winds);
   void checkZeroToleranceGroup(ElevGrp &eGrpIn, ElevGrp &eGrpOut, bool mixed = true);
   void render_timeserie(const woml::ZeroTolerance &zerotolerance);
@@ -742,7 +957,7 @@ class SvgRenderer : public woml::FeatureVisitor
                        int tXOffset,
                        int tYOffset,
                        Path::BBox *boundingBox = nullptr);
-  void renderAreaLabels(const std::list<DirectPosition> &curvePoints,
+  void renderAreaLabels(const std::vector<DirectPosition> &curvePoints,
                         NFmiFillAreas &holeAreas,
                         const std::string &confPath,
                         const std::string &textName,
@@ -763,7 +978,7 @@ class SvgRenderer : public woml::FeatureVisitor
                         const std::string &areaPlaceHolder = "");
   template <typename T>
   void renderAreaSymbols(const T &cg,
-                         const std::list<DirectPosition> &curvePoints,
+                         const std::vector<DirectPosition> &curvePoints,
                          NFmiFillAreas &holeAreas,
                          const std::string &confPath,
                          const std::string &symbolPosId,
@@ -786,6 +1001,18 @@ class SvgRenderer : public woml::FeatureVisitor
   std::ostringstream _debugoutput;
   std::shared_ptr<AxisManager> axisManager;
   bool initAerodrome;
+  std::list<const woml::Feature *> aerodromeFeatures;  // Features to prepare concurrently
+  std::map<const std::list<woml::TimeSeriesSlot> *, std::future<bool> >
+      preparedTimeseries;  // Prepared time series; whether they have holes or the error
+  RandomGenerator randomGenerator;  // Curve decoration; seeded with --seed
+  std::map<std::string, std::string> windArrowSymbols;  // Wind arrow <defs> ids by geometry
+  ConfigResolver configResolver;
+  CssClasses cssClasses;
+  std::unordered_map<std::string, SymbolSpec> symbolSpecs;
+  CoordinateWriter coordinateWriter;  // Reusable buffer for path data
+  std::optional<int> pathPrecision;   // Configured path precision
+  std::optional<double> clipMargin;   // Clipping margin, clipping is disabled if not set
+  std::optional<double> cullMargin;   // Culling margin, culling is disabled if not set
 
   // defs
   std::ostringstream masks;
@@ -830,6 +1057,7 @@ class SvgRenderer : public woml::FeatureVisitor
   int nuppertroughs;
   int nwarmadvections;
   int nwarmfronts;
+  int nculled;  // Features skipped as being outside the area
 
   FillAreas reservedAreas;
   FillAreas freeAreas;
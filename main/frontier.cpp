@@ -522,6 +522,8 @@ int run(int argc,
     // Render cloud layers first to ensure labels can be positioned within clouds
     // and using preferred position (near the center of the clouds) when ever possible
 
+    std::list<const woml::Feature*> features;
+
     for (const woml::Feature& feature : weather.forecast())
     {
       const std::optional<Fmi::DateTime> theTime = feature.validTime();
@@ -531,7 +533,7 @@ int run(int argc,
             (feature.classNameExt() == "cloudLayers") ||
             (feature.classNameExt() == "cloudLayersCB")
            )
-          feature.visit(renderer);
+          features.push_back(&feature);
     }
 
     for (const woml::Feature& feature : weather.forecast())
@@ -543,8 +545,15 @@ int run(int argc,
             (feature.classNameExt() != "cloudLayers") &&
             (feature.classNameExt() != "cloudLayersCB")
            )
-          feature.visit(renderer);
+          features.push_back(&feature);
     }
+
+    // Let the renderer prepare aerodrome time series concurrently
+
+    renderer.features(features);
+
+    for (const woml::Feature* feature : features)
+      feature->visit(renderer);
   }
 
   // Output
@@ -9,9 +9,22 @@
 #include "BezSeg.h"
 #include "BezierModel.h"
 #include "Vector2Dee.h"
+#include <algorithm>
+#include <cmath>
 
 namespace frontier
 {
+namespace
+{
+// 5-point Gauss-Legendre quadrature abscissas and weights on [-1,1]
+
+const double glAbscissas[] = {
+    0.0, -0.5384693101056831, 0.5384693101056831, -0.9061798459386640, 0.9061798459386640};
+const double glWeights[] = {
+    0.5688888888888889, 0.4786286704993665, 0.4786286704993665, 0.2369268850561891,
+    0.2369268850561891};
+}  // namespace
+
 BezSeg::BezSeg(const std::vector<DirectPosition>& theCurvePositions,
                int theSegmentIndex,
                boolean isClosedCurve,
@@ -35,12 +48,12 @@ void BezSeg::init(const std::vector<DirectPosition>& theCurvePositions,
   bIsSecondLastSegment = false;
   bIsLastSegment = false;
 
-  curvePositions = theCurvePositions;
-  //	this.curvePositions = new Arraystd::vector<DirectPosition>();
-  //	for(DirectPosition pos : curvePositions)
-  //		this.curvePositions.add(pos);
+  // The curve positions are only needed to compute the segment geometry; they are not
+  // copied to each segment
 
-  computeGeometry();
+  curvePositionCount = theCurvePositions.size();
+
+  computeGeometry(theCurvePositions);
 }
 
 void BezSeg::setTightness(double theTightness) { tightness = theTightness; }
@@ -54,13 +67,13 @@ boolean BezSeg::isChanged()
   return false;
 }
 
-void BezSeg::computeGeometry()
+void BezSeg::computeGeometry(const std::vector<DirectPosition>& curvePositions)
 {
-  computeSegmentPointPositions();
+  computeSegmentPointPositions(curvePositions);
   computeSegmentLength();
 }
 
-void BezSeg::computeSegmentPointPositions()
+void BezSeg::computeSegmentPointPositions(const std::vector<DirectPosition>& curvePositions)
 {
   // Compute four positions a Bézier segment (with index ' segmentIndex') is made up of, namely
   //
@@ -335,7 +348,7 @@ DoubleArr BezSeg::getPosition(double t)
   double oneMinusT = 1.0 - t;
   DoubleArr pos;
 
-  if (curvePositions.size() == 2)
+  if (curvePositionCount == 2)
   {
     // Use simple linear interpolation
     pos[X] = oneMinusT * start[X] + t * end[X];
@@ -511,29 +524,100 @@ DoubleArr BezSeg::getRotatedUnitVector(DoubleArr p1, DoubleArr p2, double rotati
   return Vector2Dee::getRotatedUnitVector(p1, p2, rotationAngleInDegrees);
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Length of the derivative (speed) of the cubic segment at t
+ */
+// ----------------------------------------------------------------------
+
+double BezSeg::getSpeed(double t)
+{
+  double t1 = 1. - t;
+  double a = 3. * t1 * t1;
+  double b = 6. * t1 * t;
+  double c = 3. * t * t;
+
+  double dx = a * (c1[X] - start[X]) + b * (c2[X] - c1[X]) + c * (end[X] - c2[X]);
+  double dy = a * (c1[Y] - start[Y]) + b * (c2[Y] - c1[Y]) + c * (end[Y] - c2[Y]);
+
+  return sqrt(dx * dx + dy * dy);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Arc length of the cubic segment between t0 and t1 using
+ *		  Gauss-Legendre quadrature
+ */
+// ----------------------------------------------------------------------
+
+double BezSeg::getArcLength(double t0, double t1)
+{
+  double halfWidth = (t1 - t0) / 2.;
+  double mid = (t0 + t1) / 2.;
+  double len = 0.;
+
+  for (int i = 0; i < 5; i++)
+    len += glWeights[i] * getSpeed(mid + halfWidth * glAbscissas[i]);
+
+  return len * halfWidth;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Compute segment length and the arc length table used to map
+ *		  arc length to curve parameter
+ */
+// ----------------------------------------------------------------------
+
 void BezSeg::computeSegmentLength()
 {
-  if (curvePositions.size() == 1) return;
+  if (curvePositionCount == 1) return;
 
-  if (curvePositions.size() == 2)
+  if (curvePositionCount == 2)
   {
     // Use simple linear distance length
     segmentLength = Vector2Dee::getLength(end, start);
     return;
   }
 
-  double len = 0.;
-  DoubleArr prevPos = start;
-  DoubleArr evalPos;
+  arcLengths[0] = 0.;
 
-  for (double t = 0.; t <= 1.0; t += dt / 2.)
-  {
-    evalPos = getPosition(t);
-    len += Vector2Dee::getLength(evalPos, prevPos);
-    prevPos = evalPos;
-  }
+  for (int i = 1; i <= arcLengthSamples; i++)
+    arcLengths[i] = arcLengths[i - 1] + getArcLength(double(i - 1) / arcLengthSamples,
+                                                     double(i) / arcLengthSamples);
+
+  segmentLength = arcLengths[arcLengthSamples];
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Curve parameter t [0..1] at given arc length from the start of
+ *		  the segment. The table interval is found by binary search and
+ *		  the linearly interpolated t is refined with a Newton step.
+ */
+// ----------------------------------------------------------------------
+
+double BezSeg::getParameter(double arcLength)
+{
+  if ((arcLength <= 0.) || (segmentLength <= 0.)) return 0.;
+
+  if (arcLength >= segmentLength) return 1.;
+
+  if (curvePositionCount == 2) return arcLength / segmentLength;
+
+  const double* upper =
+      std::upper_bound(arcLengths, arcLengths + arcLengthSamples + 1, arcLength);
+  int i = (upper - arcLengths) - 1;
+
+  double t0 = double(i) / arcLengthSamples;
+  double t1 = double(i + 1) / arcLengthSamples;
+  double t = t0 + (t1 - t0) * (arcLength - arcLengths[i]) / (arcLengths[i + 1] - arcLengths[i]);
+
+  double speed = getSpeed(t);
+
+  if (speed > 0.) t -= ((arcLengths[i] + getArcLength(t0, t)) - arcLength) / speed;
 
-  segmentLength = len;
+  return std::max(t0, std::min(t1, t));
 }
 
 double BezSeg::getSegmentLength() { return segmentLength; }
@@ -550,7 +634,7 @@ boolean BezSeg::isMiddleSegment()
 {
   // NB! Assumption: number of Bézier segments equals number of given curve points !
 
-  int maxSegmentIndex = curvePositions.size() - 1;
+  int maxSegmentIndex = curvePositionCount - 1;
   if ((segmentIndex <= 1) && (maxSegmentIndex <= 1)) return true;
 
   if (segmentIndex == maxSegmentIndex / 2) return true;
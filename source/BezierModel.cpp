@@ -9,7 +9,6 @@
 #include "BezierModel.h"
 #include "Vector2Dee.h"
 #include <cmath>
-#include <ctime>
 
 namespace frontier
 {
@@ -37,6 +36,11 @@ void BezierModel::init(const std::vector<DirectPosition>& theCurvePositions, boo
   orientation = POS;
   totalCurveLength = 0.;
 
+  bezierSegments.clear();
+  cumulatedCurveLength.clear();
+  bezierSegments.reserve(curvePositions.size());
+  cumulatedCurveLength.reserve(curvePositions.size());
+
   int lastIndex = curvePositions.size() - 1;
   int secondLastIndex = curvePositions.size() - 2;
 
@@ -70,17 +74,11 @@ void BezierModel::addCurvePosition(DirectPosition curvePosition, boolean isClose
   init(curvePositions, isClosedCurve);
 }
 
-double BezierModel::getCumulatedCurveLength(int i)
-{
-  std::list<double>::iterator iter = cumulatedCurveLength.begin();
-  advance(iter, i);
-
-  return *iter;
-}
+double BezierModel::getCumulatedCurveLength(int i) { return cumulatedCurveLength[i]; }
 
 const std::vector<DirectPosition>& BezierModel::getCurvePositions() { return curvePositions; }
 
-const std::list<BezSeg>& BezierModel::getBezierSegments() { return bezierSegments; }
+const std::vector<BezSeg>& BezierModel::getBezierSegments() { return bezierSegments; }
 
 int BezierModel::getBezierSegmentCount() { return bezierSegments.size(); }
 
@@ -182,12 +180,8 @@ boolean BezierModel::isClosedCurve() { return bIsClosedCurve; }
 void BezierModel::setTightness(double theTightness)
 {
   // All Bezier segments in model are assumed to be of same tightness value
-  for (std::list<BezSeg>::iterator bezSeg = bezierSegments.begin();
-       (bezSeg != bezierSegments.end());
-       bezSeg++)
-  {
-    bezSeg->setTightness(theTightness);
-  }
+  for (BezSeg& bezSeg : bezierSegments)
+    bezSeg.setTightness(theTightness);
 }
 
 double BezierModel::getTightness()
@@ -209,7 +203,24 @@ int BezierModel::getSteppedCurvePoints(
     unsigned int baseStep,   // Base distance between curve points along the line
     unsigned int maxRand,    // Max random distance added to the base
     unsigned int maxRepeat,  // Max number of subsequent points having equal distance
-    std::list<DirectPosition>& curvePoints)  // Output points
+    std::list<DirectPosition>& curvePoints,  // Output points
+    RandomGenerator& rng)                    // Random number generator for the steps
+{
+  std::vector<DirectPosition> points;
+
+  int nPoints = getSteppedCurvePoints(baseStep, maxRand, maxRepeat, points, rng);
+
+  curvePoints.assign(points.begin(), points.end());
+
+  return nPoints;
+}
+
+int BezierModel::getSteppedCurvePoints(
+    unsigned int baseStep,   // Base distance between curve points along the line
+    unsigned int maxRand,    // Max random distance added to the base
+    unsigned int maxRepeat,  // Max number of subsequent points having equal distance
+    std::vector<DirectPosition>& curvePoints,  // Output points
+    RandomGenerator& rng)                      // Random number generator for the steps
 {
   const unsigned int minBaseStep = 3;
 
@@ -224,19 +235,15 @@ int BezierModel::getSteppedCurvePoints(
   unsigned int repStep = 0;   // Counter for subsequent points having equal distance/step
   int curPos = 0;             // Current curve position
 
-  // Segment iterator
-  std::list<BezSeg>::iterator itb = bezierSegments.begin();
-
-  // Cumulative segment length iterator
-  std::list<double>::iterator itl = cumulatedCurveLength.begin(),
-                              itlEnd = cumulatedCurveLength.end();
+  // Current segment; index to the segments and their cumulative lengths
+  std::size_t seg = 0;
+  std::size_t segCount = cumulatedCurveLength.size();
 
   // Number of points
   int nPoints = 0;
 
-  srand(time(nullptr));
-
   curvePoints.clear();
+  curvePoints.reserve((curveLength / baseStep) + 2);
 
   while (true)
   {
@@ -247,7 +254,7 @@ int BezierModel::getSteppedCurvePoints(
 
       if (maxRand > 0)
       {
-        step += (int)((maxRand + 1) * (rand() / (RAND_MAX + 1.0)));
+        step += (int)((maxRand + 1) * uniformRandom(rng));
 
         if (step == prevStep)
         {
@@ -266,23 +273,21 @@ int BezierModel::getSteppedCurvePoints(
       curPos += step;
       if ((curPos + (0.5 * baseStep)) >= curveLength) curPos = curveLength;
 
-      while ((itl != itlEnd) && (*itl < curPos))
+      while ((seg < segCount) && (cumulatedCurveLength[seg] < curPos))
       {
-        lss = *itl;
-
-        itl++;
-        itb++;
+        lss = cumulatedCurveLength[seg];
+        seg++;
       }
 
-      if (itl == itlEnd)
+      if (seg == segCount)
         //
         // Never
         break;
 
-      t = ((curPos < curveLength) ? ((curPos - lss) / (*itl - lss)) : 1.0);
+      t = ((curPos < curveLength) ? bezierSegments[seg].getParameter(curPos - lss) : 1.0);
     }
 
-    curvePoints.push_back(DirectPosition(itb->getPosition(t)));
+    curvePoints.push_back(DirectPosition(bezierSegments[seg].getPosition(t)));
 
     nPoints++;
 
@@ -308,38 +313,98 @@ void BezierModel::decorateCurve(
     int scaleHeightRandom,  // Max random distance added to the base
     int controlMin,         // Base offset for the decorator points
     int controlRandom,      // Max random offset added to the base
-    std::list<DoubleArr>& decoratorPoints)  // Output; decorator points
+    std::list<DoubleArr>& decoratorPoints,  // Output; decorator points
+    RandomGenerator& rng)                   // Random number generator for the offsets
+{
+  std::vector<DoubleArr> points;
+
+  decorateCurve(std::vector<DirectPosition>(curvePoints.begin(), curvePoints.end()),
+                negative,
+                scaleHeightMin,
+                scaleHeightRandom,
+                controlMin,
+                controlRandom,
+                points,
+                rng);
+
+  decoratorPoints.assign(points.begin(), points.end());
+}
+
+// ======================================================================
+/*!
+ * \brief decorateCurve
+ *
+ * 		  Generates curve decorator points (for cloud border) for
+ * 		  contiguous curve points.
+ *
+ * 		  The random distances and offsets are drawn first (in the
+ * 		  order distance, y -offset, x -offset for each point, as the
+ * 		  former per point code evaluated them when built with gcc), leaving
+ * 		  the calculation loop without calls and branches; the decorator
+ * 		  point is offset from the midpoint of adjacent curve points
+ * 		  along the normal of the (unit) vectors from the midpoint
+ * 		  to the curve points as in Vector2Dee::getScaledNormal().
+ */
+// ======================================================================
+
+void BezierModel::decorateCurve(
+    const std::vector<DirectPosition>& curvePoints,  // Bezier curve points
+    bool negative,                                   // Decorator point direction
+    int scaleHeightMin,     // Base curve distance (normal length) for the decorator points
+    int scaleHeightRandom,  // Max random distance added to the base
+    int controlMin,         // Base offset for the decorator points
+    int controlRandom,      // Max random offset added to the base
+    std::vector<DoubleArr>& decoratorPoints,  // Output; decorator points
+    RandomGenerator& rng)                     // Random number generator for the offsets
 {
-  std::list<DirectPosition>::iterator litcp = curvePoints.begin(), cpend = curvePoints.end(), ritcp;
+  size_t nPoints = ((curvePoints.size() > 1) ? (curvePoints.size() - 1) : 0);
 
-  ritcp = litcp;
-  if (ritcp != cpend) ritcp++;
+  decoratorPoints.resize(nPoints);
 
-  srand(time(nullptr));
+  std::vector<double> randoms(3 * nPoints);
+
+  for (size_t i = 0; (i < randoms.size()); i += 3)
+  {
+    randoms[i] = scaleHeightMin + ((scaleHeightRandom + 1) * uniformRandom(rng));
+    randoms[i + 2] = (controlRandom + 1) * uniformRandom(rng);
+    randoms[i + 1] = (controlRandom + 1) * uniformRandom(rng);
+  }
 
-  decoratorPoints.clear();
+  const DirectPosition* cp = curvePoints.data();
+  DoubleArr* dp = decoratorPoints.data();
+  const double* rp = randoms.data();
 
-  for (; (ritcp != cpend); litcp++, ritcp++)
+  for (size_t i = 0; (i < nPoints); i++)
   {
-    DoubleArr leftPosition(litcp->getX(), litcp->getY());
-    DoubleArr rightPosition(ritcp->getX(), ritcp->getY());
+    double lx = cp[i].getX(), ly = cp[i].getY();
+    double rx = cp[i + 1].getX(), ry = cp[i + 1].getY();
+
+    double bx = lx + ((rx - lx) / 2.0) + 0.001;
+    double by = ly + ((ry - ly) / 2.0) + 0.001;
+
+    // Unit vectors from the midpoint to the curve points; displaced slightly if opposite
+
+    double ldx = lx - bx, ldy = ly - by, llen = sqrt(ldx * ldx + ldy * ldy);
+    double rdx = rx - bx, rdy = ry - by, rlen = sqrt(rdx * rdx + rdy * rdy);
+
+    double v1x = ((llen == 0) ? 0. : (ldx / llen)), v1y = ((llen == 0) ? 0. : (ldy / llen));
+    double v2x = ((rlen == 0) ? 0. : (rdx / rlen)), v2y = ((rlen == 0) ? 0. : (rdy / rlen));
+
+    bool opposite = ((v1x == -v2x) && (v1y == -v2y));
+    v1x += (opposite ? 0.00001 : 0.);
+    v2y += (opposite ? 0.00001 : 0.);
 
-    DoubleArr basePosition(leftPosition[0] + ((rightPosition[0] - leftPosition[0]) / 2.0) + 0.001,
-                           leftPosition[1] + ((rightPosition[1] - leftPosition[1]) / 2.0) + 0.001);
+    // Unit normal, oriented by the cross product
 
-    DoubleArr normalScale = Vector2Dee::getScaledNormal(
-        leftPosition,
-        basePosition,
-        rightPosition,
-        negative ? NEG : POS,
-        scaleHeightMin + ((scaleHeightRandom + 1) * (rand() / (RAND_MAX + 1.0))));
+    double sx = v1x + v2x, sy = v1y + v2y, slen = sqrt(sx * sx + sy * sy);
+    double nx = ((slen == 0) ? 0. : (sx / slen)), ny = ((slen == 0) ? 0. : (sy / slen));
 
-    DoubleArr control(basePosition[0] + normalScale[0] + controlMin +
-                          ((controlRandom + 1) * (rand() / (RAND_MAX + 1.0))),
-                      basePosition[1] + normalScale[1] + controlMin +
-                          ((controlRandom + 1) * (rand() / (RAND_MAX + 1.0))));
+    double crossProd = v1x * v2y - v1y * v2x;
+    bool flip = (negative ? (crossProd >= 0.) : (crossProd < 0.));
+    double scale = (flip ? -rp[3 * i] : rp[3 * i]);
 
-    decoratorPoints.push_back(control);
+    dp[i] = DoubleArr(bx + (scale * nx) + controlMin + rp[3 * i + 1],
+                      by + (scale * ny) + controlMin + rp[3 * i + 2]);
   }
 }
 
@@ -0,0 +1,292 @@
+// ======================================================================
+/*!
+ * \brief frontier::CoordinateWriter
+ */
+// ======================================================================
+
+#include "CoordinateWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+namespace frontier
+{
+// ----------------------------------------------------------------------
+/*!
+ * \brief Constructor
+ */
+// ----------------------------------------------------------------------
+
+CoordinateWriter::CoordinateWriter(int thePrecision, Encoding theEncoding)
+    : itsEncoding(theEncoding)
+{
+  precision(thePrecision);
+  beginPath();
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Set the number of decimals
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::precision(int thePrecision)
+{
+  itsPrecision = thePrecision;
+  itsScale = std::pow(10.0, thePrecision);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Discard the contents
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::clear()
+{
+  itsBuffer.clear();
+  beginPath();
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Append a coordinate using the current precision
+ */
+// ----------------------------------------------------------------------
+
+CoordinateWriter& CoordinateWriter::operator<<(double theValue)
+{
+  fmt::format_to(std::back_inserter(itsBuffer), "{:.{}f}", theValue, itsPrecision);
+  return *this;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Append a character
+ */
+// ----------------------------------------------------------------------
+
+CoordinateWriter& CoordinateWriter::operator<<(char theChar)
+{
+  itsBuffer.push_back(theChar);
+  itsLastNumber = NoNumber;
+  return *this;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Append text
+ */
+// ----------------------------------------------------------------------
+
+CoordinateWriter& CoordinateWriter::operator<<(const char* theText)
+{
+  itsBuffer.append(theText, theText + strlen(theText));
+  itsLastNumber = NoNumber;
+  return *this;
+}
+
+CoordinateWriter& CoordinateWriter::operator<<(const std::string& theText)
+{
+  itsBuffer.append(theText.data(), theText.data() + theText.size());
+  itsLastNumber = NoNumber;
+  return *this;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Start new path data. The first command of the path is not
+ *		  preceded by a separator and relative coordinates are taken
+ *		  from origo.
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::beginPath()
+{
+  itsCommand = 0;
+  itsLastNumber = NoNumber;
+  itsX = itsY = itsStartX = itsStartY = 0;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Path commands
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::moveTo(double x, double y)
+{
+  command('M');
+  coordinate(x, y);
+
+  itsStartX = itsX;
+  itsStartY = itsY;
+}
+
+void CoordinateWriter::lineTo(double x, double y)
+{
+  command('L');
+  coordinate(x, y);
+}
+
+void CoordinateWriter::quadTo(double x1, double y1, double x, double y)
+{
+  command('Q');
+
+  if (itsEncoding == Absolute)
+  {
+    *this << x1 << ',' << y1 << ' ' << x << ',' << y;
+    return;
+  }
+
+  // Control point is relative to the current point too
+
+  number(round(x1) - itsX);
+  number(round(y1) - itsY);
+  coordinate(x, y);
+}
+
+void CoordinateWriter::curveTo(double x1, double y1, double x2, double y2, double x, double y)
+{
+  command('C');
+
+  if (itsEncoding == Absolute)
+  {
+    *this << x1 << ',' << y1 << ' ' << x2 << ',' << y2 << ' ' << x << ',' << y;
+    return;
+  }
+
+  number(round(x1) - itsX);
+  number(round(y1) - itsY);
+  number(round(x2) - itsX);
+  number(round(y2) - itsY);
+  coordinate(x, y);
+}
+
+void CoordinateWriter::closePath()
+{
+  command('Z');
+
+  itsX = itsStartX;
+  itsY = itsStartY;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Write path command (given in uppercase) unless it is implied by
+ *		  the previous command
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::command(char theCommand)
+{
+  if (itsEncoding == Absolute)
+  {
+    if (itsCommand != 0)
+      itsBuffer.push_back(' ');
+    if (theCommand != itsCommand)
+      itsBuffer.push_back(theCommand);
+  }
+  else if ((theCommand != itsCommand) || (theCommand == 'M') || (theCommand == 'Z'))
+  {
+    // Repeated 'm' would be taken as lineto and 'z' has no arguments to repeat
+
+    itsBuffer.push_back(static_cast<char>(theCommand - 'A' + 'a'));
+    itsLastNumber = NoNumber;
+  }
+
+  itsCommand = theCommand;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Write end point of a command and set it as the current point
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::coordinate(double x, double y)
+{
+  if (itsEncoding == Absolute)
+  {
+    *this << x << ',' << y;
+    return;
+  }
+
+  x = round(x);
+  y = round(y);
+
+  number(x - itsX);
+  number(y - itsY);
+
+  itsX = x;
+  itsY = y;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Write a number in compact form, with a separator only if the
+ *		  number could otherwise be taken as part of the previous one
+ */
+// ----------------------------------------------------------------------
+
+void CoordinateWriter::number(double theValue)
+{
+  char tmp[64];
+  auto result = fmt::format_to_n(tmp, sizeof(tmp), "{:.{}f}", theValue, itsPrecision);
+  char* first = tmp;
+  char* last = tmp + std::min(result.size, sizeof(tmp));
+
+  bool negative = (*first == '-');
+  char* digits = (negative ? first + 1 : first);
+  char* dot = std::find(digits, last, '.');
+
+  // Drop trailing zeros and decimal point
+
+  if (dot != last)
+  {
+    while (*(last - 1) == '0')
+      last--;
+    if (last - 1 == dot)
+      last = dot;
+  }
+
+  // Drop leading zero of a fraction; "-0" is written as "0"
+
+  if ((*digits == '0') && (digits + 1 < last))
+  {
+    if (negative)
+      *digits = '-';
+    first++;
+    digits++;
+  }
+  else if ((*digits == '0') && negative)
+  {
+    first++;
+    negative = false;
+  }
+
+  // Separator is needed unless the number starts with a minus sign or with a
+  // decimal point following a number which already has one
+
+  if ((itsLastNumber != NoNumber) && !negative &&
+      ((*digits != '.') || (itsLastNumber == IntegerNumber)))
+    itsBuffer.push_back(' ');
+
+  itsBuffer.append(first, last);
+  itsLastNumber = (std::find(digits, last, '.') != last) ? DecimalNumber : IntegerNumber;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Round a coordinate to the precision
+ */
+// ----------------------------------------------------------------------
+
+double CoordinateWriter::round(double theValue) const
+{
+  return std::round(theValue * itsScale) / itsScale;
+}
+
+}  // namespace frontier
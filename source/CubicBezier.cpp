@@ -5,10 +5,57 @@
 // ======================================================================
 
 #include "CubicBezier.h"
-#include "clipper.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace frontier
 {
+namespace
+{
+// Maximum subdivision depth; deeper segments are taken as flat
+const int maxDepth = 32;
+
+// Segment control points packed as x1,y1,x2,y2,x3,y3,x4,y4
+typedef double Segment[8];
+
+inline double dist(const double* p1, const double* p2)
+{
+  return std::sqrt((p1[0] - p2[0]) * (p1[0] - p2[0]) + (p1[1] - p2[1]) * (p1[1] - p2[1]));
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Split the segment in half (de Casteljau)
+ */
+// ----------------------------------------------------------------------
+
+inline void subdivide(const Segment& s, Segment& part1, Segment& part2)
+{
+  double b[6], c[4], d[2];
+
+  for (int i = 0; i < 6; i++)
+    b[i] = (s[i] + s[i + 2]) / 2;
+  for (int i = 0; i < 4; i++)
+    c[i] = (b[i] + b[i + 2]) / 2;
+  for (int i = 0; i < 2; i++)
+    d[i] = (c[i] + c[i + 2]) / 2;
+
+  for (int i = 0; i < 2; i++)
+  {
+    part1[i] = s[i];
+    part1[i + 2] = b[i];
+    part1[i + 4] = c[i];
+    part1[i + 6] = d[i];
+
+    part2[i] = d[i];
+    part2[i + 2] = c[i + 2];
+    part2[i + 4] = b[i + 4];
+    part2[i + 6] = s[i + 6];
+  }
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Construct from points
@@ -57,62 +104,118 @@ std::pair<CubicBezier, CubicBezier> CubicBezier::split() const
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Calculate the length of the Bezier
+ * \brief Calculate the length of the Bezier. Stores the control points of
+ *	    the subdivided segments (4 points per segment) and the cumulative
+ *	    lengths at the points (starting from given offset) if requested.
+ *
+ *	    The curve is subdivided until the control polygon's length differs
+ *	    from the chord less than the relative limit 'eps' or (if given) the
+ *	    absolute 'tolerance' (in pixels). The segments are processed in
+ *	    order using an explicit stack; the segment lengths are summed
+ *	    pairwise like the halves of a recursive subdivision would be.
  */
 // ----------------------------------------------------------------------
 
-double CubicBezier::length(
-    double eps, NFmiFillMap* fmap, double* lastx, double* lasty, ClipperLib::Path* path) const
+double CubicBezier::length(double eps,
+                           std::vector<Point>* points,
+                           std::vector<double>* lengths,
+                           double offset,
+                           double tolerance) const
 {
-  // Length along control points and the end points
-  double chord = distance(P1, P4);
-  double arc = distance(P1, P2) + distance(P2, P3) + distance(P3, P4);
+  Segment stack[maxDepth + 1];
+  int depths[maxDepth + 1];
+  double sums[maxDepth + 2];
+  int sumDepths[maxDepth + 2];
+  int top = 0, sumTop = 0;
+  double pos = offset;
+
+  const double root[8] = {P1.x, P1.y, P2.x, P2.y, P3.x, P3.y, P4.x, P4.y};
+  std::copy(root, root + 8, stack[0]);
+  depths[0] = 0;
+
+  while (top >= 0)
+  {
+    const Segment& s = stack[top];
+    int depth = depths[top];
 
-  // Safety check which also guarantees arc>0 and termination
-  // even if eps is way too small
+    // Length along control points and the end points
+    double chord = dist(s, s + 6);
+    double arc = dist(s, s + 2) + dist(s + 2, s + 4) + dist(s + 4, s + 6);
+    double len;
 
-  if (chord == 0) return 0;
+    // Safety check which also guarantees arc>0 and termination
+    // even if eps is way too small
 
-  // Safety check which guarantees termination if chord is way too small
+    if (chord == 0)
+      len = 0;
 
-  if ((chord / arc) < eps) return chord;
+    // Safety check which guarantees termination if chord is way too small
 
-  // If the relative difference is small, return good length estimate
-  if ((arc - chord) / arc < eps)
-  {
-    if (fmap && lastx && lasty)
-    {
-      fmap->Add(*lastx, *lasty, P1.x, P1.y);
-      fmap->Add(P1.x, P1.y, P2.x, P2.y);
-      fmap->Add(P2.x, P2.y, P3.x, P3.y);
-      fmap->Add(P3.x, P3.y, P4.x, P4.y);
+    else if ((chord / arc) < eps)
+      len = chord;
 
-      *lastx = P4.x;
-      *lasty = P4.y;
-    }
+    // If the difference is small, use good length estimate
 
-    if (path)
+    else if (((arc - chord) / arc < eps) || ((arc - chord) < tolerance) || (depth == maxDepth))
     {
-      // Storing the bezier curve as segmentized lines/points. The segmentized path will be used
-      // to scale up the surface to get enough fill positions.
-      //
-      *path << ClipperLib::IntPoint(P1.x, P1.y);
-      *path << ClipperLib::IntPoint(P2.x, P2.y);
-      *path << ClipperLib::IntPoint(P3.x, P3.y);
-      *path << ClipperLib::IntPoint(P4.x, P4.y);
+      len = 0.5 * (arc + chord);
+
+      if (points)
+      {
+        // Storing the bezier curve as segmentized lines/points. The segmentized path is used
+        // for fill maps and to scale up the surface to get enough fill positions.
+        //
+        for (int i = 0; i < 8; i += 2)
+          points->push_back(Point(s[i], s[i + 1]));
+
+        if (lengths)
+        {
+          // Distribute the length along the control points
+
+          double d12 = dist(s, s + 2), d23 = dist(s + 2, s + 4);
+
+          lengths->push_back(pos);
+          lengths->push_back(pos + len * (d12 / arc));
+          lengths->push_back(pos + len * ((d12 + d23) / arc));
+          lengths->push_back(pos + len);
+        }
+      }
     }
+    else
+    {
+      // Otherwise subdivide; the first half is processed next
 
-    return 0.5 * (arc + chord);
-  }
+      Segment part1, part2;
+      subdivide(s, part1, part2);
 
-  // Otherwise subdivide and recurse
+      std::copy(part2, part2 + 8, stack[top]);
+      depths[top] = depth + 1;
+      top++;
+      std::copy(part1, part1 + 8, stack[top]);
+      depths[top] = depth + 1;
 
-  std::pair<CubicBezier, CubicBezier> parts = split();
+      continue;
+    }
+
+    top--;
+    pos += len;
+
+    // Sum the lengths of the halves once both are done
+
+    sums[sumTop] = len;
+    sumDepths[sumTop] = depth;
 
-  double l1 = parts.first.length(eps, fmap, lastx, lasty, path);
-  double l2 = parts.second.length(eps, fmap, lastx, lasty, path);
+    while ((sumTop > 0) && (sumDepths[sumTop - 1] == sumDepths[sumTop]))
+    {
+      sumTop--;
+      sums[sumTop] += sums[sumTop + 1];
+      sumDepths[sumTop]--;
+    }
+
+    sumTop++;
+  }
 
-  return l1 + l2;
+  return sums[0];
 }
 
 }  // namespace frontier
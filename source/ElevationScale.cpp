@@ -0,0 +1,73 @@
+// ======================================================================
+/*!
+ * \brief frontier::ElevationScale
+ */
+// ======================================================================
+
+#include "ElevationScale.h"
+
+#include <algorithm>
+
+namespace frontier
+{
+// ----------------------------------------------------------------------
+/*!
+ * \brief Remove all breakpoints
+ */
+// ----------------------------------------------------------------------
+
+void ElevationScale::clear()
+{
+  itsElevations.clear();
+  itsScales.clear();
+  itsFactors.clear();
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Add a breakpoint. The breakpoints must be added in rising
+ *		  elevation order.
+ */
+// ----------------------------------------------------------------------
+
+void ElevationScale::add(double theElevation, double theScale)
+{
+  if (!itsElevations.empty())
+    itsFactors.back() = (theScale - itsScales.back()) / (theElevation - itsElevations.back());
+
+  itsElevations.push_back(theElevation);
+  itsScales.push_back(theScale);
+  itsFactors.push_back(0.0);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Relative position of the elevation by linear interpolation
+ *		  between the enclosing breakpoints. Elevations outside the
+ *		  breakpoint range get the position of the nearest breakpoint.
+ */
+// ----------------------------------------------------------------------
+
+double ElevationScale::scale(double theElevation) const
+{
+  if (itsElevations.empty())
+    return 0.0;
+
+  std::size_t i =
+      std::lower_bound(itsElevations.begin(), itsElevations.end(), theElevation) -
+      itsElevations.begin();
+
+  if (i == itsElevations.size())
+    return itsScales.back();
+
+  if ((itsElevations[i] > theElevation) && (i > 0))
+  {
+    i--;
+
+    return itsScales[i] + ((theElevation - itsElevations[i]) * itsFactors[i]);
+  }
+
+  return itsScales[i];
+}
+
+}  // namespace frontier
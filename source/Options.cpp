@@ -30,7 +30,8 @@ Options::Options()
       womlfile(),
       outfile("-"),
       type(""),
-      locale("")
+      locale(""),
+      seed(0)
 {
 }
 
@@ -56,6 +57,7 @@ bool parse_options(int argc, char* argv[], Options& theOptions)
       ("Document type: 'conceptualmodelanalysis', 'conceptualmodelforecast' or "
        "'aerodromeforecast'");
   std::string msglocale = ("locale");
+  std::string msgseed = ("random seed for curve decorations, default=0");
 
   bool dummy = false;
 
@@ -70,6 +72,7 @@ bool parse_options(int argc, char* argv[], Options& theOptions)
       "outfile,o", po::value(&theOptions.outfile), msgoutfile.c_str())(
       "type,t", po::value(&theOptions.type), msgtype.c_str())(
       "locale,l", po::value(&theOptions.locale), msglocale.c_str())(
+      "seed", po::value(&theOptions.seed), msgseed.c_str())(
       "nocontours,n", po::bool_switch(&dummy), "deprecated options which have no effect");
 
   po::positional_options_description p;
@@ -5,11 +5,11 @@
 // ======================================================================
 
 #include "Path.h"
+#include "CoordinateWriter.h"
 #include "CubicBezier.h"
 #include "PathTransformation.h"
+#include <algorithm>
 #include <cmath>
-#include <iomanip>
-#include <sstream>
 #include <stdexcept>
 
 #include "clipper.hpp"
@@ -23,11 +23,12 @@ namespace frontier
 /*!
  * \brief Supported absolute SVG path elements
  *
- * Note: We store the enums as doubles, which forces us
- * to make explicit conversions to avoid warnings. This
- * is an intentional design choice to keep the representation
- * as simple as possible. In particular we want to avoid
- * a class structure of path elements
+ * Note: The elements are stored as bytes separately from
+ * the coordinates, which are stored as x,y pairs into a
+ * single contiguous array. This is an intentional design
+ * choice to keep the representation as simple as possible.
+ * In particular we want to avoid a class structure of path
+ * elements
  */
 // ----------------------------------------------------------------------
 
@@ -45,7 +46,11 @@ enum PathElement
  */
 // ----------------------------------------------------------------------
 
-void Path::closepath() { pathdata.push_back(ClosePath); }
+void Path::closepath()
+{
+  elements.push_back(ClosePath);
+  invalidate();
+}
 
 // ----------------------------------------------------------------------
 /*!
@@ -55,9 +60,10 @@ void Path::closepath() { pathdata.push_back(ClosePath); }
 
 void Path::moveto(double x, double y)
 {
-  pathdata.push_back(MoveTo);
-  pathdata.push_back(x);
-  pathdata.push_back(y);
+  elements.push_back(MoveTo);
+  coordinates.push_back(x);
+  coordinates.push_back(y);
+  invalidate();
 }
 
 // ----------------------------------------------------------------------
@@ -68,9 +74,10 @@ void Path::moveto(double x, double y)
 
 void Path::lineto(double x, double y)
 {
-  pathdata.push_back(LineTo);
-  pathdata.push_back(x);
-  pathdata.push_back(y);
+  elements.push_back(LineTo);
+  coordinates.push_back(x);
+  coordinates.push_back(y);
+  invalidate();
 }
 
 // ----------------------------------------------------------------------
@@ -81,13 +88,14 @@ void Path::lineto(double x, double y)
 
 void Path::curveto(double x1, double y1, double x2, double y2, double x, double y)
 {
-  pathdata.push_back(CurveTo);
-  pathdata.push_back(x1);
-  pathdata.push_back(y1);
-  pathdata.push_back(x2);
-  pathdata.push_back(y2);
-  pathdata.push_back(x);
-  pathdata.push_back(y);
+  elements.push_back(CurveTo);
+  coordinates.push_back(x1);
+  coordinates.push_back(y1);
+  coordinates.push_back(x2);
+  coordinates.push_back(y2);
+  coordinates.push_back(x);
+  coordinates.push_back(y);
+  invalidate();
 }
 
 // ----------------------------------------------------------------------
@@ -98,62 +106,74 @@ void Path::curveto(double x1, double y1, double x2, double y2, double x, double
 
 Path& Path::operator+=(const Path& path)
 {
-  std::copy(path.pathdata.begin(), path.pathdata.end(), std::back_inserter(pathdata));
+  elements.insert(elements.end(), path.elements.begin(), path.elements.end());
+  coordinates.insert(coordinates.end(), path.coordinates.begin(), path.coordinates.end());
+  invalidate();
   return *this;
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Reserve room for path elements and points
+ */
+// ----------------------------------------------------------------------
+
+void Path::reserve(std::size_t elementCount, std::size_t pointCount)
+{
+  elements.reserve(elementCount);
+  coordinates.reserve(2 * pointCount);
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief SVG representation of the curve
  */
 // ----------------------------------------------------------------------
 
-std::string Path::svg() const
+std::string Path::svg(int precision) const
 {
-  std::ostringstream out;
+  CoordinateWriter out(precision);
+  svg(out);
+  return out.str();
+}
 
-  char lastelement = ' ';
-  char element = ' ';
+// ----------------------------------------------------------------------
+/*!
+ * \brief Append SVG representation of the curve to given writer
+ */
+// ----------------------------------------------------------------------
 
-  for (PathData::size_type i = 0; i < pathdata.size();)
-  {
-    if (i != 0) out << ' ';
-    out << std::fixed << std::setprecision(1);
+void Path::svg(CoordinateWriter& out) const
+{
+  const double* coords = coordinates.data();
+  PathCoordinates::size_type i = 0;
+
+  out.beginPath();
 
-    PathElement cmd = static_cast<PathElement>(pathdata[i++]);
+  for (PathElements::size_type n = 0; n < elements.size(); n++)
+  {
+    PathElement cmd = static_cast<PathElement>(elements[n]);
 
     switch (cmd)
     {
       case ClosePath:
-        element = 'Z';
-        if (element != lastelement) out << element;
-        lastelement = element;
+        out.closePath();
         break;
       case MoveTo:
-        element = 'M';
-        if (element != lastelement) out << element;
-        lastelement = element;
-        out << pathdata[i] << ',' << pathdata[i + 1];
+        out.moveTo(coords[i], coords[i + 1]);
         i += 2;
         break;
       case LineTo:
-        element = 'L';
-        if (element != lastelement) out << element;
-        lastelement = element;
-        out << pathdata[i] << ',' << pathdata[i + 1];
+        out.lineTo(coords[i], coords[i + 1]);
         i += 2;
         break;
       case CurveTo:
-        element = 'C';
-        if (element != lastelement) out << element;
-        lastelement = element;
-        out << pathdata[i] << ',' << pathdata[i + 1] << ' ' << pathdata[i + 2] << ','
-            << pathdata[i + 3] << ' ' << pathdata[i + 4] << ',' << pathdata[i + 5];
+        out.curveTo(
+            coords[i], coords[i + 1], coords[i + 2], coords[i + 3], coords[i + 4], coords[i + 5]);
         i += 6;
         break;
     }
   }
-  return out.str();
 }
 
 // ----------------------------------------------------------------------
@@ -162,26 +182,55 @@ std::string Path::svg() const
  */
 // ----------------------------------------------------------------------
 
-bool Path::empty() const { return pathdata.empty(); }
+bool Path::empty() const { return elements.empty(); }
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Length of the curve. Adds the curve points to a fillmap to be used
- * 	    when determing positions for symbol/pattern fill.
+ * \brief Discard the flattened path
  */
 // ----------------------------------------------------------------------
 
-double Path::length(NFmiFillMap* fmap) const
+void Path::invalidate()
 {
+  flatdata.clear();
+  flatlength = 0;
+  flattened = false;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Flatten the path into a polyline with cumulative arc lengths.
+ *	    The curves are subdivided until flat enough and their control
+ *	    points are used as the polyline points.
+ */
+// ----------------------------------------------------------------------
+
+const Path::FlatData& Path::flatten() const
+{
+  if (flattened) return flatdata;
+
   double len = 0;
   double lastx = 0;
   double lasty = 0;
   double startx = 0;
   double starty = 0;
 
-  for (PathData::size_type i = 0; i < pathdata.size();)
+  std::vector<Point> points;
+  std::vector<double> lengths;
+
+  const double* coords = coordinates.data();
+  PathCoordinates::size_type i = 0;
+
+  flatdata.clear();
+
+  for (PathElements::size_type n = 0; n < elements.size(); n++)
   {
-    PathElement cmd = static_cast<PathElement>(pathdata[i++]);
+    PathElement cmd = static_cast<PathElement>(elements[n]);
+
+    // The pen is at origo if the path does not start with moveto
+
+    if ((cmd != MoveTo) && flatdata.empty())
+      flatdata.push_back(FlatPoint(lastx, lasty, len, PenPosition));
 
     switch (cmd)
     {
@@ -190,42 +239,80 @@ double Path::length(NFmiFillMap* fmap) const
         len += sqrt(sqr(lastx - startx) + sqr(lasty - starty));
         lastx = startx;
         lasty = starty;
+        flatdata.push_back(FlatPoint(lastx, lasty, len, PenPosition));
         break;
       case MoveTo:
-        lastx = pathdata[i];
-        lasty = pathdata[i + 1];
+        lastx = coords[i];
+        lasty = coords[i + 1];
         // start new subpath
         startx = lastx;
         starty = lasty;
+        flatdata.push_back(FlatPoint(lastx, lasty, len, SubPathStart));
         i += 2;
         break;
       case LineTo:
-        len += sqrt(sqr(lastx - pathdata[i]) + sqr(lasty - pathdata[i + 1]));
-        if (fmap) fmap->Add(lastx, lasty, pathdata[i], pathdata[i + 1]);
-        lastx = pathdata[i];
-        lasty = pathdata[i + 1];
+        len += sqrt(sqr(lastx - coords[i]) + sqr(lasty - coords[i + 1]));
+        lastx = coords[i];
+        lasty = coords[i + 1];
+        flatdata.push_back(FlatPoint(lastx, lasty, len, LineVertex));
         i += 2;
         break;
       case CurveTo:
       {
         CubicBezier bez(lastx,
                         lasty,
-                        pathdata[i],
-                        pathdata[i + 1],
-                        pathdata[i + 2],
-                        pathdata[i + 3],
-                        pathdata[i + 4],
-                        pathdata[i + 5]);
+                        coords[i],
+                        coords[i + 1],
+                        coords[i + 2],
+                        coords[i + 3],
+                        coords[i + 4],
+                        coords[i + 5]);
         double eps = 0.001;
-        len += bez.length(eps, fmap, &lastx, &lasty);
-        lastx = pathdata[i + 4];
-        lasty = pathdata[i + 5];
+
+        points.clear();
+        lengths.clear();
+        len += bez.length(eps, &points, &lengths, len);
+
+        for (size_t p = 0; p < points.size(); p++)
+          flatdata.push_back(FlatPoint(points[p].x, points[p].y, lengths[p], LineVertex));
+
+        lastx = coords[i + 4];
+        lasty = coords[i + 5];
+
+        // Degenerate (not stored) segments at the end of the curve; move the pen to the end point
+
+        if ((flatdata.back().x != lastx) || (flatdata.back().y != lasty))
+          flatdata.push_back(FlatPoint(lastx, lasty, len, PenPosition));
+
         i += 6;
         break;
       }
     }
   }
-  return len;
+
+  flatlength = len;
+  flattened = true;
+
+  return flatdata;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Length of the curve. Adds the curve points to a fillmap to be used
+ * 	    when determing positions for symbol/pattern fill.
+ */
+// ----------------------------------------------------------------------
+
+double Path::length(NFmiFillMap* fmap) const
+{
+  const FlatData& flat = flatten();
+
+  if (fmap)
+    for (FlatData::size_type i = 1; i < flat.size(); i++)
+      if (flat[i].type == LineVertex)
+        fmap->Add(flat[i - 1].x, flat[i - 1].y, flat[i].x, flat[i].y);
+
+  return flatlength;
 }
 
 // ----------------------------------------------------------------------
@@ -236,27 +323,10 @@ double Path::length(NFmiFillMap* fmap) const
 
 void Path::transform(const PathTransformation& transformation)
 {
-  for (PathData::size_type i = 0; i < pathdata.size();)
-  {
-    PathElement cmd = static_cast<PathElement>(pathdata[i++]);
+  for (PathCoordinates::size_type i = 0; i < coordinates.size(); i += 2)
+    transformation(coordinates[i], coordinates[i + 1]);
 
-    switch (cmd)
-    {
-      case ClosePath:
-        break;
-      case MoveTo:
-      case LineTo:
-        transformation(pathdata[i], pathdata[i + 1]);
-        i += 2;
-        break;
-      case CurveTo:
-        transformation(pathdata[i], pathdata[i + 1]);
-        transformation(pathdata[i + 2], pathdata[i + 3]);
-        transformation(pathdata[i + 4], pathdata[i + 5]);
-        i += 6;
-        break;
-    }
-  }
+  invalidate();
 }
 
 // ----------------------------------------------------------------------
@@ -273,39 +343,9 @@ bool Path::scale(double offset, Path& scaledPath) const
   using namespace ClipperLib;
 
   ClipperLib::Path srcPath;
-  double lastx = 0;
-  double lasty = 0;
-
-  for (PathData::size_type i = 0; i < pathdata.size();)
-  {
-    PathElement cmd = static_cast<PathElement>(pathdata[i++]);
 
-    switch (cmd)
-    {
-      case ClosePath:
-        break;
-      case MoveTo:
-      case LineTo:
-        srcPath << IntPoint(lastx = pathdata[i], lasty = pathdata[i + 1]);
-        i += 2;
-        break;
-      case CurveTo:
-        CubicBezier bez(lastx,
-                        lasty,
-                        pathdata[i],
-                        pathdata[i + 1],
-                        pathdata[i + 2],
-                        pathdata[i + 3],
-                        pathdata[i + 4],
-                        pathdata[i + 5]);
-        double eps = 0.001;
-        bez.length(eps, nullptr, nullptr, nullptr, &srcPath);
-        lastx = pathdata[i + 4];
-        lasty = pathdata[i + 5];
-        i += 6;
-        break;
-    }
-  }
+  for (const FlatPoint& point : flatten())
+    if (point.type != PenPosition) srcPath << IntPoint(point.x, point.y);
 
   // Scale the 'clipper' path
   //
@@ -344,6 +384,7 @@ bool Path::scale(double offset, Path& scaledPath) const
       if ((isScaled = (solution.front().size() > 2)))
       {
         scaledPath.clear();
+        scaledPath.reserve(solution.front().size() + 1, solution.front().size());
 
         for (ClipperLib::Path::const_iterator it = solution.front().begin();
              (it != solution.front().end());
@@ -367,106 +408,557 @@ bool Path::scale(double offset, Path& scaledPath) const
  */
 // ----------------------------------------------------------------------
 
-void Path::walk(size_t i, BBox& bbox, double x, double y) const
+Path::BBox Path::getBBox() const
+{
+  BBox bbox;
+
+  if (coordinates.empty()) return bbox;
+
+  bbox.blX = bbox.trX = coordinates[0];
+  bbox.blY = bbox.trY = coordinates[1];
+
+  for (PathCoordinates::size_type i = 2; i < coordinates.size(); i += 2)
+  {
+    bbox.blX = std::min(bbox.blX, coordinates[i]);
+    bbox.trX = std::max(bbox.trX, coordinates[i]);
+    bbox.blY = std::min(bbox.blY, coordinates[i + 1]);
+    bbox.trY = std::max(bbox.trY, coordinates[i + 1]);
+  }
+
+  return bbox;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Return nearest vertex to the given point. Curves are represented
+ *	    by the points of the flattened path.
+ */
+// ----------------------------------------------------------------------
+
+std::pair<double, double> Path::nearestVertex(double x, double y) const
+{
+  double mindistance = -1;
+  double bestx = 0;
+  double besty = 0;
+
+  for (const FlatPoint& point : flatten())
+  {
+    if (point.type == PenPosition) continue;
+
+    double dist = distance(x, y, point.x, point.y);
+    if (mindistance < 0 || dist < mindistance)
+    {
+      mindistance = dist;
+      bestx = point.x;
+      besty = point.y;
+    }
+  }
+  if (mindistance < 0) throw std::runtime_error("No nearest vertex exists for empty paths");
+
+  return std::make_pair(bestx, besty);
+}
+
+namespace
+{
+// ----------------------------------------------------------------------
+/*!
+ * \brief Squared distance of a point from a line segment
+ */
+// ----------------------------------------------------------------------
+
+double segmentDistance2(const Point& p, const Point& p1, const Point& p2)
+{
+  double dx = p2.x - p1.x;
+  double dy = p2.y - p1.y;
+  double len2 = dx * dx + dy * dy;
+  double t = ((len2 > 0) ? ((p.x - p1.x) * dx + (p.y - p1.y) * dy) / len2 : 0);
+
+  t = std::max(0.0, std::min(1.0, t));
+
+  return sqr(p.x - (p1.x + t * dx)) + sqr(p.y - (p1.y + t * dy));
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Douglas-Peucker simplification of points [first,last]. The
+ *	    points further than the tolerance from the simplified line are
+ *	    marked to be kept; the end points are not marked here.
+ */
+// ----------------------------------------------------------------------
+
+void douglasPeucker(const std::vector<Point>& points,
+                    std::size_t first,
+                    std::size_t last,
+                    double tolerance,
+                    std::vector<char>& keep)
 {
-  if (i == 1)
+  std::vector<std::pair<std::size_t, std::size_t> > ranges(1, std::make_pair(first, last));
+  double tolerance2 = tolerance * tolerance;
+
+  while (!ranges.empty())
   {
-    bbox.blX = bbox.trX = x;
-    bbox.blY = bbox.trY = y;
+    std::size_t i = ranges.back().first;
+    std::size_t j = ranges.back().second;
+    ranges.pop_back();
+
+    double maxdist = -1;
+    std::size_t farthest = i;
+
+    for (std::size_t k = i + 1; k < j; k++)
+    {
+      double dist = segmentDistance2(points[k], points[i], points[j]);
+      if (dist > maxdist)
+      {
+        maxdist = dist;
+        farthest = k;
+      }
+    }
+
+    if (maxdist > tolerance2)
+    {
+      keep[farthest] = 1;
+      ranges.push_back(std::make_pair(i, farthest));
+      ranges.push_back(std::make_pair(farthest, j));
+    }
   }
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Simplify a subpath and append it to the output path.
+ *
+ *	    A ring (a closed subpath or a subpath ending to its start point)
+ *	    is split at the point farthest from the start point and the halves
+ *	    are simplified separately. A ring keeps at least 3 points.
+ */
+// ----------------------------------------------------------------------
+
+void simplifySubPath(std::vector<Point>& points, bool closed, double tolerance, Path& out)
+{
+  if (points.empty()) return;
+
+  std::size_t n = points.size();
+  bool endsAtStart =
+      ((n > 1) && (points[n - 1].x == points[0].x) && (points[n - 1].y == points[0].y));
+  bool ring = (closed || endsAtStart);
+
+  // For rings use the start point as the last point too
+
+  if (ring && !endsAtStart) points.push_back(points[0]);
+
+  std::size_t last = points.size() - 1;
+  std::vector<char> keep(points.size(), 0);
+
+  keep[0] = keep[last] = 1;
+
+  if (!ring)
+    douglasPeucker(points, 0, last, tolerance, keep);
+  else if (last <= 3)
+    std::fill(keep.begin(), keep.end(), 1);
   else
   {
-    if (x < bbox.blX)
-      bbox.blX = x;
-    else if (x > bbox.trX)
-      bbox.trX = x;
-
-    if (y < bbox.blY)
-      bbox.blY = y;
-    else if (y > bbox.trY)
-      bbox.trY = y;
+    std::size_t farthest = 1;
+    double maxdist = -1;
+
+    for (std::size_t k = 1; k < last; k++)
+    {
+      double dist = sqr(points[k].x - points[0].x) + sqr(points[k].y - points[0].y);
+      if (dist > maxdist)
+      {
+        maxdist = dist;
+        farthest = k;
+      }
+    }
+
+    keep[farthest] = 1;
+    douglasPeucker(points, 0, farthest, tolerance, keep);
+    douglasPeucker(points, farthest, last, tolerance, keep);
+
+    if (std::count(keep.begin(), keep.end(), 1) < 4)
+    {
+      // Only the start point (twice) and the split point remain; keep the point farthest
+      // from the line between them too
+
+      std::size_t third = 1;
+      maxdist = -1;
+
+      for (std::size_t k = 1; k < last; k++)
+      {
+        double dist = segmentDistance2(points[k], points[0], points[farthest]);
+        if ((k != farthest) && (dist > maxdist))
+        {
+          maxdist = dist;
+          third = k;
+        }
+      }
+
+      keep[third] = 1;
+    }
   }
+
+  // Output the kept points; closed subpath does not repeat the start point
+
+  std::size_t end = ((closed && !endsAtStart) ? last : last + 1);
+
+  out.moveto(points[0].x, points[0].y);
+
+  for (std::size_t k = 1; k < end; k++)
+    if (keep[k]) out.lineto(points[k].x, points[k].y);
+
+  if (closed) out.closepath();
 }
 
-Path::BBox Path::getBBox() const
+// ----------------------------------------------------------------------
+/*!
+ * \brief Clip a polygon against one edge of a rectangle
+ *	    (Sutherland-Hodgman). 'edge' is 0 (xmin), 1 (xmax), 2 (ymin)
+ *	    or 3 (ymax).
+ */
+// ----------------------------------------------------------------------
+
+void clipPolygon(const std::vector<Point>& input,
+                 std::vector<Point>& output,
+                 int edge,
+                 double limit)
 {
-  BBox bbox;
+  output.clear();
+
+  if (input.empty()) return;
+
+  auto inside = [edge, limit](const Point& p) {
+    switch (edge)
+    {
+      case 0:
+        return (p.x >= limit);
+      case 1:
+        return (p.x <= limit);
+      case 2:
+        return (p.y >= limit);
+      default:
+        return (p.y <= limit);
+    }
+  };
+
+  auto intersection = [edge, limit](const Point& p1, const Point& p2) {
+    if (edge < 2)
+      return Point(limit, p1.y + (p2.y - p1.y) * (limit - p1.x) / (p2.x - p1.x));
+    return Point(p1.x + (p2.x - p1.x) * (limit - p1.y) / (p2.y - p1.y), limit);
+  };
+
+  const Point* prev = &input.back();
+  bool prevInside = inside(*prev);
+
+  for (const Point& p : input)
+  {
+    bool pInside = inside(p);
+
+    if (pInside != prevInside) output.push_back(intersection(*prev, p));
+    if (pInside) output.push_back(p);
+
+    prev = &p;
+    prevInside = pInside;
+  }
+}
+
+// Flatness (in pixels) used when curves of partially visible surfaces are converted to lines
+
+const double clipFlatness = 0.1;
 
-  for (PathData::size_type i = 0; i < pathdata.size();)
+}  // namespace
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Simplify the path with given tolerance (in pixels) using
+ *	    Douglas-Peucker algorithm. Curves are flattened to lines.
+ *	    Nothing is done if the tolerance is not positive.
+ */
+// ----------------------------------------------------------------------
+
+void Path::simplify(double tolerance)
+{
+  if ((tolerance <= 0) || elements.empty()) return;
+
+  Path out;
+  out.reserve(elements.size(), coordinates.size() / 2);
+
+  std::vector<Point> points;
+  std::vector<Point> curvePoints;
+  double lastx = 0;
+  double lasty = 0;
+  double startx = 0;
+  double starty = 0;
+
+  const double* coords = coordinates.data();
+  PathCoordinates::size_type i = 0;
+
+  for (PathElements::size_type n = 0; n < elements.size(); n++)
   {
-    PathElement cmd = static_cast<PathElement>(pathdata[i++]);
+    PathElement cmd = static_cast<PathElement>(elements[n]);
+
+    // A subpath not starting with moveto starts from the current point
+
+    if ((cmd == LineTo || cmd == CurveTo) && points.empty())
+      points.push_back(Point(lastx, lasty));
 
     switch (cmd)
     {
       case ClosePath:
+        simplifySubPath(points, true, tolerance, out);
+        points.clear();
+        lastx = startx;
+        lasty = starty;
         break;
       case MoveTo:
+        simplifySubPath(points, false, tolerance, out);
+        points.clear();
+        lastx = startx = coords[i];
+        lasty = starty = coords[i + 1];
+        points.push_back(Point(lastx, lasty));
+        i += 2;
+        break;
       case LineTo:
-        walk((size_t)i, bbox, pathdata[i], pathdata[i + 1]);
+        lastx = coords[i];
+        lasty = coords[i + 1];
+        points.push_back(Point(lastx, lasty));
         i += 2;
         break;
       case CurveTo:
-        walk((size_t)i, bbox, pathdata[i], pathdata[i + 1]);
-        walk((size_t)i, bbox, pathdata[i + 2], pathdata[i + 3]);
-        walk((size_t)i, bbox, pathdata[i + 4], pathdata[i + 5]);
+      {
+        CubicBezier bez(lastx,
+                        lasty,
+                        coords[i],
+                        coords[i + 1],
+                        coords[i + 2],
+                        coords[i + 3],
+                        coords[i + 4],
+                        coords[i + 5]);
+
+        curvePoints.clear();
+        bez.length(0.001, &curvePoints, nullptr, 0, tolerance);
+
+        for (const Point& point : curvePoints)
+          if ((point.x != points.back().x) || (point.y != points.back().y))
+            points.push_back(point);
+
+        lastx = coords[i + 4];
+        lasty = coords[i + 5];
+
+        if ((points.back().x != lastx) || (points.back().y != lasty))
+          points.push_back(Point(lastx, lasty));
+
         i += 6;
         break;
+      }
     }
   }
 
-  return bbox;
+  simplifySubPath(points, false, tolerance, out);
+
+  elements.swap(out.elements);
+  coordinates.swap(out.coordinates);
+  invalidate();
 }
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Return nearest vertex to the given point
+ * \brief Clip the path to given rectangle.
+ *
+ *	    Subpaths inside the rectangle are kept as is and subpaths outside
+ *	    it are removed. Partially visible closed subpaths (surfaces) are
+ *	    flattened and clipped to the rectangle. From partially visible
+ *	    open subpaths (fronts, contours) the segments (lines or curves)
+ *	    outside the rectangle are removed, the subpath is split at the
+ *	    removed segments and the remaining segments are kept intact.
  */
 // ----------------------------------------------------------------------
 
-std::pair<double, double> Path::nearestVertex(double x, double y) const
+void Path::clip(double xmin, double ymin, double xmax, double ymax)
 {
-  double mindistance = -1;
-  double bestx = 0;
-  double besty = 0;
+  auto inside = [&](const double* p, std::size_t n) {
+    for (std::size_t k = 0; k < 2 * n; k += 2)
+      if ((p[k] < xmin) || (p[k] > xmax) || (p[k + 1] < ymin) || (p[k + 1] > ymax)) return false;
+    return true;
+  };
+
+  auto overlaps = [&](double x, double y, const double* p, std::size_t n) {
+    double x1 = x, y1 = y, x2 = x, y2 = y;
+    for (std::size_t k = 0; k < 2 * n; k += 2)
+    {
+      x1 = std::min(x1, p[k]);
+      x2 = std::max(x2, p[k]);
+      y1 = std::min(y1, p[k + 1]);
+      y2 = std::max(y2, p[k + 1]);
+    }
+    return ((x1 <= xmax) && (x2 >= xmin) && (y1 <= ymax) && (y2 >= ymin));
+  };
+
+  Path out;
+  out.reserve(elements.size(), coordinates.size() / 2);
+
+  std::vector<Point> polygon, clipped, curvePoints;
+  double startx = 0;
+  double starty = 0;
 
-  for (PathData::size_type i = 0; i < pathdata.size();)
+  const double* coords = coordinates.data();
+  PathElements::size_type n = 0;
+  PathCoordinates::size_type i = 0;
+
+  while (n < elements.size())
   {
-    PathElement cmd = static_cast<PathElement>(pathdata[i++]);
+    // Subpath elements [n0,n) and coordinates [i0,i); a subpath not starting with moveto
+    // starts from the current point (start point of the previous subpath)
 
-    switch (cmd)
+    PathElements::size_type n0 = n;
+    PathCoordinates::size_type i0 = i;
+    bool closed = false;
+
+    if (elements[n] == MoveTo)
     {
-      case ClosePath:
+      startx = coords[i];
+      starty = coords[i + 1];
+      n++;
+      i += 2;
+    }
+
+    for (; (n < elements.size()) && (elements[n] != MoveTo); n++)
+    {
+      if (elements[n] == ClosePath)
+      {
+        closed = true;
+        n++;
         break;
-      case MoveTo:
-      case LineTo:
+      }
+
+      i += ((elements[n] == LineTo) ? 2 : 6);
+    }
+
+    std::size_t npoints = (i - i0) / 2;
+
+    const double start[2] = {startx, starty};
+
+    if (inside(start, 1) && inside(coords + i0, npoints))
+    {
+      // Visible subpath
+
+      if (elements[n0] != MoveTo) out.moveto(startx, starty);
+
+      out.elements.insert(out.elements.end(), elements.begin() + n0, elements.begin() + n);
+      out.coordinates.insert(out.coordinates.end(), coords + i0, coords + i);
+    }
+    else if (!overlaps(startx, starty, coords + i0, npoints))
+      ;  // Invisible subpath
+    else if (closed)
+    {
+      // Partially visible surface; flatten and clip
+
+      double lastx = startx;
+      double lasty = starty;
+
+      polygon.clear();
+      polygon.push_back(Point(startx, starty));
+
+      for (PathElements::size_type e = n0, k = i0; e < n; e++)
       {
-        double dist = distance(x, y, pathdata[i], pathdata[i + 1]);
-        if (mindistance < 0 || dist < mindistance)
+        if (elements[e] == LineTo)
         {
-          mindistance = dist;
-          bestx = pathdata[i];
-          besty = pathdata[i + 1];
+          polygon.push_back(Point(coords[k], coords[k + 1]));
+          k += 2;
         }
-        i += 2;
-        break;
+        else if (elements[e] == CurveTo)
+        {
+          CubicBezier bez(lastx,
+                          lasty,
+                          coords[k],
+                          coords[k + 1],
+                          coords[k + 2],
+                          coords[k + 3],
+                          coords[k + 4],
+                          coords[k + 5]);
+
+          curvePoints.clear();
+          bez.length(0.001, &curvePoints, nullptr, 0, clipFlatness);
+
+          for (const Point& point : curvePoints)
+            if ((point.x != polygon.back().x) || (point.y != polygon.back().y))
+              polygon.push_back(point);
+
+          k += 6;
+        }
+        else if (elements[e] == MoveTo)
+          k += 2;
+        else
+          continue;
+
+        lastx = coords[k - 2];
+        lasty = coords[k - 1];
+
+        if ((polygon.back().x != lastx) || (polygon.back().y != lasty))
+          polygon.push_back(Point(lastx, lasty));
       }
-      case CurveTo:
+
+      clipPolygon(polygon, clipped, 0, xmin);
+      clipPolygon(clipped, polygon, 1, xmax);
+      clipPolygon(polygon, clipped, 2, ymin);
+      clipPolygon(clipped, polygon, 3, ymax);
+
+      if (polygon.size() > 2)
       {
-        double dist = distance(x, y, pathdata[i + 4], pathdata[i + 5]);
-        if (mindistance < 0 || dist < mindistance)
+        for (std::size_t k = 0; k < polygon.size(); k++)
+          if (k == 0)
+            out.moveto(polygon[k].x, polygon[k].y);
+          else
+            out.lineto(polygon[k].x, polygon[k].y);
+
+        out.closepath();
+      }
+    }
+    else
+    {
+      // Partially visible open subpath; keep the visible segments
+
+      double lastx = startx;
+      double lasty = starty;
+      bool drawing = false;
+
+      for (PathElements::size_type e = n0, k = i0; e < n; e++)
+      {
+        if (elements[e] == MoveTo)
         {
-          mindistance = dist;
-          bestx = pathdata[i];
-          besty = pathdata[i + 1];
+          k += 2;
+          continue;
         }
-        i += 6;
-        break;
+
+        std::size_t segmentPoints = ((elements[e] == LineTo) ? 1 : 3);
+
+        if (overlaps(lastx, lasty, coords + k, segmentPoints))
+        {
+          if (!drawing) out.moveto(lastx, lasty);
+
+          if (segmentPoints == 1)
+            out.lineto(coords[k], coords[k + 1]);
+          else
+            out.curveto(coords[k],
+                        coords[k + 1],
+                        coords[k + 2],
+                        coords[k + 3],
+                        coords[k + 4],
+                        coords[k + 5]);
+
+          drawing = true;
+        }
+        else
+          drawing = false;
+
+        k += 2 * segmentPoints;
+        lastx = coords[k - 2];
+        lasty = coords[k - 1];
       }
     }
   }
-  if (mindistance < 0) throw std::runtime_error("No nearest vertex exists for empty paths");
 
-  return std::make_pair(bestx, besty);
+  elements.swap(out.elements);
+  coordinates.swap(out.coordinates);
+  invalidate();
 }
 
 }  // namespace frontier
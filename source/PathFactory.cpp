@@ -146,7 +146,9 @@ Path create(const woml::CubicSplineRing& spline)
   for (size_t i = 0; i < n; ++i)
     x[i] -= fact * z[i];
 
-  // Build the path
+  // Build the path; moveto, n curves and closepath
+
+  path.reserve(n + 2, 3 * n + 1);
 
   for (size_t i = 0; i < n; ++i)
   {
@@ -229,6 +231,10 @@ Path create(const woml::SimpleCubicSpline& spline)
   for (size_t i = 1; i < ctrl.size(); i++)
     ctrl[ctrl.size() - i - 1] -= tmp[ctrl.size() - i] * ctrl[ctrl.size() - i];  // Backsubstitution.
 
+  // Build the path; moveto and n curves
+
+  path.reserve(n + 1, 3 * n + 1);
+
   double x, y, x1, y1, x2, y2;
   for (size_t i = 0; i < n; ++i)
   {
@@ -32,6 +32,7 @@
 #include <smartmet/tron/SavitzkyGolay2D.h>
 #include <smartmet/tron/Traits.h>
 #include <smartmet/woml/CloudArea.h>
+#include <smartmet/woml/CubicSplineCurve.h>
 #include <smartmet/woml/CubicSplineSurface.h>
 #include <smartmet/woml/GeophysicalParameterValueSet.h>
 #include <smartmet/woml/InfoText.h>
@@ -45,12 +46,15 @@
 #include <smartmet/woml/StormType.h>
 #include <smartmet/woml/SurfacePrecipitationArea.h>
 #include <cairo.h>
+#include <algorithm>
 #include <cmath>
 #include <functional>
+#include <future>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <list>
+#include <set>
 
 // clang-format off
 #include <smartmet/tron/FmiBuilder.h>
@@ -168,6 +172,58 @@ std::string svgescapetext(const std::string &theText, bool wrapScands = false)
   return ret;
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Extend projected bounding box by spline's control points
+ */
+// ----------------------------------------------------------------------
+
+template <typename T>
+void extendBBox(const NFmiArea &area, const T &spline, std::optional<Path::BBox> &bbox)
+{
+  for (size_t i = 0; i < spline.size(); i++)
+  {
+    NFmiPoint xy = area.ToXY(NFmiPoint(spline[i].lon(), spline[i].lat()));
+
+    if (!bbox)
+      bbox = Path::BBox(xy.X(), xy.Y(), xy.X(), xy.Y());
+    else
+    {
+      bbox->blX = std::min(bbox->blX, xy.X());
+      bbox->blY = std::min(bbox->blY, xy.Y());
+      bbox->trX = std::max(bbox->trX, xy.X());
+      bbox->trY = std::max(bbox->trY, xy.Y());
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Projected bounding box of curve's or surface's control points.
+ *	    Unset if there are no points.
+ */
+// ----------------------------------------------------------------------
+
+std::optional<Path::BBox> controlBBox(const NFmiArea &area, const woml::CubicSplineCurve &splines)
+{
+  std::optional<Path::BBox> bbox;
+
+  for (const woml::SimpleCubicSpline &spline : splines)
+    extendBBox(area, spline, bbox);
+
+  return bbox;
+}
+
+std::optional<Path::BBox> controlBBox(const NFmiArea &area, const woml::CubicSplineSurface &surface)
+{
+  // Interior rings are inside the exterior
+
+  std::optional<Path::BBox> bbox;
+  extendBBox(area, surface.exterior(), bbox);
+
+  return bbox;
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Functor for projecting a path
@@ -201,6 +257,7 @@ class PathProjector : public PathTransformation
 // ----------------------------------------------------------------------
 
 void render_front(const Path &path,
+                  const CoordinateWriter &pathData,
                   std::ostringstream &paths,
                   std::ostringstream &fronts,
                   const std::string &id,
@@ -211,7 +268,7 @@ void render_front(const Path &path,
                   double fontsize,
                   double spacing)
 {
-  paths << "<path id=\"" << id << "\" d=\"" << path.svg() << "\"/>\n";
+  paths << "<path id=\"" << id << "\" d=\"" << pathData << "\"/>\n";
 
   fronts << "<use class=\"" << lineclass << "\" xlink:href=\"#" << id << "\"/>\n";
 
@@ -239,33 +296,147 @@ void render_front(const Path &path,
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Utility function for reading configuration value from local or global scope
+ * \brief Utility function for reading optional configuration value without throwing.
+ *		The setting is overridden by '<param>_' setting if it is set.
+ *
+ *		'typeMismatch' is set if the setting exists but has wrong type.
  */
 // ----------------------------------------------------------------------
 
 template <typename T>
-T _lookup(const libconfig::Setting &scope,
-          const std::string &scopeName,
-          const std::string &param,
-          settings settingId = s_required,
-          bool *isSet = nullptr)
+std::optional<T> _lookupOptional(const libconfig::Setting &scope,
+                                 const std::string &param,
+                                 bool &typeMismatch)
 {
-  T value = lookup<T>(scope, scopeName, param, settingId, isSet);
+  std::optional<T> value = lookup_optional<T>(scope, param, &typeMismatch);
 
-  if (isSet && (*isSet))
+  if (value)
   {
     // Setting was found, check if it is overridden
     //
-    bool _isSet;
-    T _value = lookup<T>(scope, scopeName, param + "_", s_optional, &_isSet);
+    std::optional<T> _value = lookup_optional<T>(scope, param + "_", &typeMismatch);
 
-    if (_isSet)
+    if (_value || typeMismatch)
       return _value;
   }
 
   return value;
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Utility function for reading optional configuration value from given scope.
+ *
+ *		If the setting has wrong type, it is read with secondary type. Missing
+ *		setting is returned as unset value; std::runtime_error is thrown only if the
+ *		setting has wrong type.
+ */
+// ----------------------------------------------------------------------
+
+template <typename T, typename T2>
+std::optional<T> configOptional(const libconfig::Setting &scope,
+                                const std::string &scopeName,
+                                const std::string &param)
+{
+  bool typeMismatch;
+  std::optional<T> value = _lookupOptional<T>(scope, param, typeMismatch);
+
+  if (typeMismatch && (typeid(T) != typeid(T2)))
+  {
+    std::optional<T2> value2 = _lookupOptional<T2>(scope, param, typeMismatch);
+
+    if (value2)
+      return boost::lexical_cast<T>(*value2);
+  }
+
+  if (typeMismatch)
+    throw std::runtime_error("Setting for " + scopeName + "." + param + " has wrong type, " +
+                             type_names<T, T2>() + " expected");
+
+  return value;
+}
+
+template <typename T>
+std::optional<T> configOptional(const libconfig::Setting &scope,
+                                const std::string &scopeName,
+                                const std::string &param)
+{
+  return configOptional<T, T>(scope, scopeName, param);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Utility function for reading optional configuration value from active scope.
+ *
+ *		The scope is searched in reverse order; matchingScope (if available) is set to
+ *		point the matching scope if setting is found.
+ */
+// ----------------------------------------------------------------------
+
+template <typename T, typename T2>
+std::optional<T> configOptional(const std::list<const libconfig::Setting *> &scope,
+                                const std::string &scopeName,
+                                const std::string &param,
+                                const libconfig::Setting **matchingScope = nullptr)
+{
+  for (auto riter = scope.rbegin(); (riter != scope.rend()); riter++)
+  {
+    std::optional<T> value = configOptional<T, T2>(**riter, scopeName, param);
+
+    if (value)
+    {
+      if (matchingScope)
+        *matchingScope = *riter;
+
+      return value;
+    }
+  }
+
+  if (matchingScope)
+    *matchingScope = nullptr;
+
+  return std::nullopt;
+}
+
+template <typename T>
+std::optional<T> configOptional(const std::list<const libconfig::Setting *> &scope,
+                                const std::string &scopeName,
+                                const std::string &param,
+                                const libconfig::Setting **matchingScope = nullptr)
+{
+  return configOptional<T, T>(scope, scopeName, param, matchingScope);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Utility function for reporting missing configuration value
+ */
+// ----------------------------------------------------------------------
+
+template <typename T>
+T missingValue(const std::string &scopeName, const std::string &param, settings settingId)
+{
+  // If 's_optional' setting is not found, unset (default constructor) value is returned.
+  //
+  // If specific ('s_base' + n) setting is not found, SettingIdNotFoundException is thrown;
+  // otherwise std::runtime_error is thrown.
+
+  if (settingId == s_optional)
+    return T();
+
+  if (settingId != s_required)
+    throw SettingIdNotFoundException(settingId,
+                                     "Setting for " + scopeName + "." + param + " is missing");
+
+  throw std::runtime_error("Setting for " + scopeName + "." + param + " is missing");
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Utility function for reading configuration value from local or global scope
+ */
+// ----------------------------------------------------------------------
+
 template <typename T, typename T2>
 T configValue(const libconfig::Setting &localScope,
               const std::string &localScopeName,
@@ -284,87 +455,24 @@ T configValue(const libconfig::Setting &localScope,
   //
   // matchingScope (if available) is set to point the matching scope if setting is found.
 
-  // Read the setting as optional. If the reading fails, try to read with secondary type
+  // Read the setting from local scope and then from global scope if available
 
-  T value = T();
   const libconfig::Setting *scope = &localScope;
-  bool _isSet = false;
-
-  try
-  {
-    try
-    {
-      value = _lookup<T>(localScope, localScopeName, param, s_optional, &_isSet);
-    }
-    catch (const libconfig::SettingTypeException&)
-    {
-      if (typeid(T) != typeid(T2))
-      {
-        T2 value2 = _lookup<T2>(localScope, localScopeName, param, s_optional, &_isSet);
-        value = boost::lexical_cast<T>(value2);
-      }
-      else
-        throw;
-    }
-  }
-  catch (const libconfig::SettingNotFoundException&)
-  {
-    _isSet = false;
-  }
-  catch (const libconfig::SettingTypeException&)
-  {
-    throw std::runtime_error("Setting for " + localScopeName + "." + param + " has wrong type, " +
-                             type_names<T,T2>() + " expected");
-  }
+  std::optional<T> value = configOptional<T, T2>(localScope, localScopeName, param);
 
-  // Try global scope if available
-
-  if ((!_isSet) && (scope = globalScope))
-  {
-    try
-    {
-      try
-      {
-        value = _lookup<T>(*globalScope, localScopeName, param, s_optional, &_isSet);
-      }
-      catch (const libconfig::SettingTypeException&)
-      {
-        if (typeid(T) != typeid(T2))
-        {
-          T2 value2 = _lookup<T2>(*globalScope, localScopeName, param, s_optional, &_isSet);
-          value = boost::lexical_cast<T>(value2);
-        }
-        else
-          throw;
-      }
-    }
-    catch (const libconfig::SettingNotFoundException&)
-    {
-      _isSet = false;
-    }
-    catch (const libconfig::SettingTypeException&)
-    {
-      throw std::runtime_error("Setting for " + localScopeName + "." + param + " has wrong type, " +
-                               type_names<T,T2>() + " expected");
-    }
-  }
+  if ((!value) && (scope = globalScope))
+    value = configOptional<T, T2>(*globalScope, localScopeName, param);
 
   if (isSet)
-    *isSet = _isSet;
+    *isSet = value.has_value();
 
   if (matchingScope)
-    *matchingScope = (_isSet ? scope : nullptr);
+    *matchingScope = (value ? scope : nullptr);
 
-  if (_isSet || (settingId == s_optional))
-    return value;
-
-  // Throw SettingIdNotFoundException for specific settings
-
-  if (settingId != s_required)
-    throw SettingIdNotFoundException(settingId,
-                                     "Setting for " + localScopeName + "." + param + " is missing");
+  if (value)
+    return *value;
 
-  throw std::runtime_error("Setting for " + localScopeName + "." + param + " is missing");
+  return missingValue<T>(localScopeName, param, settingId);
 }
 
 template <typename T>
@@ -394,48 +502,24 @@ T configValue(std::list<const libconfig::Setting *> &scope,
               bool *isSet = nullptr,
               bool truncate = false)
 {
-  T value = T();
   const libconfig::Setting *matchingScope = nullptr;
-  bool _isSet = false;
-
-  std::list<const libconfig::Setting *>::reverse_iterator rbegiter(scope.end()),
-      renditer(scope.begin()), riter, it, git;
-
-  for (riter = rbegiter; ((riter != renditer) && (!_isSet));)
-  {
-    it = riter;
-    riter++;
-    git = riter;
-
-    if (riter != renditer)
-      riter++;
-
-    // For the last block(s) use the given settingId; the call throws if the setting is required but
-    // not found
-    //
-    value = configValue<T, T2>(**it,
-                               localScopeName,
-                               param,
-                               ((git != renditer) ? *git : nullptr),
-                               (riter != renditer) ? s_optional : settingId,
-                               &_isSet,
-                               &matchingScope);
-  }
+  std::optional<T> value = configOptional<T, T2>(scope, localScopeName, param, &matchingScope);
 
   if (isSet)
-    *isSet = _isSet;
+    *isSet = value.has_value();
+
+  if (!value)
+    return missingValue<T>(localScopeName, param, settingId);
 
-  if (truncate && _isSet)
+  if (truncate)
   {
     // Truncate the scope to have the matching block as the last block
     //
-    std::list<const libconfig::Setting *>::iterator fenditer = scope.end(),
-                                                    fiter =
-                                                        ((matchingScope == *it) ? it : git).base();
-    scope.erase(fiter, fenditer);
+    auto riter = std::find(scope.rbegin(), scope.rend(), matchingScope);
+    scope.erase(riter.base(), scope.end());
   }
 
-  return value;
+  return *value;
 }
 
 template <typename T>
@@ -524,9 +608,174 @@ void SvgRenderer::render_aerodrome(const T &theFeature)
     initAerodrome = false;
   }
 
+  if (!aerodromeFeatures.empty())
+    prepareAerodrome();
+
   render_timeserie(theFeature);
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Store the features to be rendered
+ */
+// ----------------------------------------------------------------------
+
+void SvgRenderer::features(const std::list<const woml::Feature *> &theFeatures)
+{
+  aerodromeFeatures = theFeatures;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Concurrent elevation grouping for aerodrome time series.
+ *
+ *		Group numbering and hole search only modify the feature's own
+ *		time serie; they are done concurrently for all cloud layer,
+ *		icing, turbulence, contrail and zero tolerance features before
+ *		rendering them in order. The group configurations are loaded
+ *		beforehand; the configuration is not accessed concurrently.
+ *		In debug mode the features are prepared sequentially to keep
+ *		the debug output in order.
+ *
+ *		If loading the configuration fails, the feature is not prepared;
+ *		the error is reported when rendering it. If preparing a feature
+ *		fails, the error is rethrown when rendering it.
+ */
+// ----------------------------------------------------------------------
+
+void SvgRenderer::prepareAerodrome()
+{
+  std::launch policy = (options.debug ? std::launch::deferred : std::launch::async);
+
+  for (const woml::Feature *feature : aerodromeFeatures)
+  {
+    const std::list<woml::TimeSeriesSlot> *ts = nullptr;
+    auto memberSet = std::make_shared<std::set<size_t> >();
+    std::shared_ptr<CategoryValueMeasureGroup> category;
+    bool mixed = true, holes = true;
+
+    try
+    {
+      if (auto cloudlayers = dynamic_cast<const woml::CloudLayers *>(feature))
+      {
+        ts = &cloudlayers->timeseries();
+        category = loadCloudGroupCategory(*memberSet);
+      }
+      else if (auto icing = dynamic_cast<const woml::Icing *>(feature))
+      {
+        ts = &icing->timeseries();
+        category = loadGroupCategory<IcingGroupCategory, IcingGroup>("Icing", *memberSet);
+      }
+      else if (auto turbulence = dynamic_cast<const woml::Turbulence *>(feature))
+      {
+        ts = &turbulence->timeseries();
+        category = loadGroupCategory<TurbulenceGroupCategory, TurbulenceGroup>("Turbulence",
+                                                                               *memberSet);
+      }
+      else if (auto contrails = dynamic_cast<const woml::Contrails *>(feature))
+      {
+        ts = &contrails->timeseries();
+        mixed = holes = false;
+      }
+      else if (auto zerotolerance = dynamic_cast<const woml::ZeroTolerance *>(feature))
+        ts = &zerotolerance->timeseries();
+      else
+        continue;
+    }
+    catch (...)
+    {
+      // The document is not modified yet; the error is reported when rendering the feature
+
+      continue;
+    }
+
+    // The task shares the group category and the member set referenced by it
+
+    preparedTimeseries[ts] = std::async(policy,
+                                        [this, ts, category, memberSet, mixed, holes]()
+                                        {
+                                          setGroupNumbers(*ts, mixed);
+                                          return (holes && searchHoles(*ts, category.get()));
+                                        });
+  }
+
+  aerodromeFeatures.clear();
+
+  for (auto &prepared : preparedTimeseries)
+    prepared.second.wait();
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Load cloud layer grouping configuration
+ */
+// ----------------------------------------------------------------------
+
+std::shared_ptr<CategoryValueMeasureGroup> SvgRenderer::loadCloudGroupCategory(
+    std::set<size_t> &cloudSet)
+{
+  bool borderCompensation;
+  double tightness, labelPosHeightFactor;
+  int minLabelPosHeight;
+  auto cloudGroupCategory = std::make_shared<CloudGroupCategory>();
+
+  cloudLayerConfig("CloudLayers",
+                   tightness,
+                   borderCompensation,
+                   minLabelPosHeight,
+                   labelPosHeightFactor,
+                   cloudGroupCategory->groups(),
+                   cloudSet);
+
+  return cloudGroupCategory;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Load icing or turbulence grouping configuration
+ */
+// ----------------------------------------------------------------------
+
+template <typename GroupCategoryT, typename GroupTypeT>
+std::shared_ptr<CategoryValueMeasureGroup> SvgRenderer::loadGroupCategory(
+    const std::string &confPath, std::set<size_t> &memberSet)
+{
+  double tightness, labelPosHeightFactor;
+  int minLabelPosHeight;
+  auto category = std::make_shared<GroupCategoryT>();
+
+  groupConfig<GroupTypeT>(confPath,
+                          tightness,
+                          minLabelPosHeight,
+                          labelPosHeightFactor,
+                          category->groups(),
+                          memberSet);
+
+  return category;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Check if time serie's elevation grouping is done; if so, get
+ *		whether it has holes. Rethrows the error if grouping failed
+ */
+// ----------------------------------------------------------------------
+
+bool SvgRenderer::preparedTimeserie(const std::list<woml::TimeSeriesSlot> &ts, bool &hasHole)
+{
+  auto it = preparedTimeseries.find(&ts);
+
+  if (it == preparedTimeseries.end())
+    return false;
+
+  std::future<bool> prepared(std::move(it->second));
+  preparedTimeseries.erase(it);
+
+  hasHole = prepared.get();
+
+  return true;
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Initialization for aerodrome rendering.
@@ -707,135 +956,77 @@ void SvgRenderer::render_header(const std::string &hdrClass,
       return;
     }
 
-    const char *typeMsg = " must contain a list of groups in parenthesis";
     const char *hdrtypeMsg = ": type must be 'datetime'";
 
-    const libconfig::Setting &hdrSpecs = config.lookup(confPath);
-    if (!hdrSpecs.isList())
-      throw std::runtime_error(confPath + typeMsg);
-
-    settings s_name((settings)(s_base + 0));
-
-    // Configuration blocks to search values for the settings; global blocks (blocks with no name
-    // and no locale),
-    // locale global blocks (blocks with matching name but having no locale and blocks having no
-    // name
-    // but with matching locale) and the current block (block with matching name and locale).
+    // Configuration blocks to search values for the settings; global blocks (blocks with no name)
+    // and the current block (block with matching name), both having no locale or matching locale.
     //
     // The blocks are stored to the list in the order of appearance (and having current block
     // as the last element). The list is processed in reverse order when searching.
     //
-    // Current block or locale global block is needed for rendering.
+    // Current block or global block is needed for rendering.
     //
     // Note: Currently no locale settings are required.
 
-    std::list<const libconfig::Setting *> scope;
-    bool nameMatch, noName;
-    bool hasLocaleGlobals = false;
+    const ConfigScope *hdrScope = configResolver.scope(confPath, hdrClass, true);
+
+    if (!hdrScope)
+    {
+      // No settings for confPath
+      //
+      if (options.debug)
+        debugoutput << "Settings for " << confPath << " (" << hdrClass << ") not found\n";
+
+      return;
+    }
 
-    int hdrIdx = -1;
-    int lastIdx = hdrSpecs.getLength() - 1;
+    std::list<const libconfig::Setting *> scope(hdrScope->scope);
 
-    for (int i = 0; i <= lastIdx; ++i)
+    if (!scope.empty())
     {
-      const libconfig::Setting &specs = hdrSpecs[i];
-      if (!specs.isGroup())
-        throw std::runtime_error(confPath + typeMsg);
+      // Type (currently only datetime supported)
+      std::string type = configValue<std::string>(scope, hdrClass, "type", s_optional);
 
-      try
+      if (type.empty() || (type == "datetime"))
       {
-        noName = false;
-        nameMatch = (lookup<std::string>(specs, confPath, "name", s_name) == hdrClass);
-      }
-      catch (SettingIdNotFoundException &ex)
-      {
-        // Global settings have no name; go on to check locale
+        // NFmiTime language and format
         //
-        noName = true;
-        nameMatch = false;
-      }
+        FmiLanguage language = locale2FmiLanguage(confPath, options.locale);
+        std::string pref(configValue<std::string>(scope, hdrClass, "pref")), prefDate,
+            &format = pref;
 
-      // Enter the block on matching name, and for globals and last config entry
-      // to load/use the globals
-      //
-      if (nameMatch || noName || ((i == lastIdx) && hasLocaleGlobals))
-      {
-        if (nameMatch || noName)
+        if (useDate)
         {
-          if (nameMatch)
-            hdrIdx = i;
-
-          // Locale
-          //
-          std::string locale(
-              toLower(configValue<std::string>(specs, hdrClass, "locale", nullptr, s_optional)));
-          bool localeMatch = (locale == options.locale);
+          prefDate = configValue<std::string>(scope, hdrClass, "prefdate", s_optional);
 
-          if (localeMatch || (locale == ""))
-          {
-            scope.push_back(&specs);
-
-            // Currently no locale settings are required
-            //
-            //						if ((nameMatch && (locale == "")) || (noName
-            //&&
-            // localeMatch))
-            if ((nameMatch && (locale == "")) || (noName /* && localeMatch */))
-              hasLocaleGlobals = true;
-          }
-
-          // Currently no locale settings are required
-          //
-          //					if ((noName || (!localeMatch)) && ((i < lastIdx) ||
-          //(!hasLocaleGlobals)))
-          if ((noName || ((!localeMatch) && (locale != ""))) &&
-              ((i < lastIdx) || (!hasLocaleGlobals)))
-            continue;
+          if (!prefDate.empty())
+            format = prefDate;
         }
 
-        // Type (currently only datetime supported)
-        std::string type = configValue<std::string>(scope, hdrClass, "type", s_optional);
-
-        if (type.empty() || (type == "datetime"))
-        {
-          // NFmiTime language and format
-          //
-          FmiLanguage language = locale2FmiLanguage(confPath, options.locale);
-          std::string pref(configValue<std::string>(scope, hdrClass, "pref")), prefDate,
-              &format = pref;
+        // utc
+        bool isSet;
+        bool utc(configValue<bool>(scope, hdrClass, "utc", s_optional, &isSet));
 
-          if (useDate)
-          {
-            prefDate = configValue<std::string>(scope, hdrClass, "prefdate", s_optional);
+        // Store formatted datum
+        texts[HEADERhdrClass]
+            << (datetime.is_not_a_date_time()
+                    ? ""
+                    : svgescapetext(
+                          toFormattedString(datetime, format, isSet && utc, language).CharPtr(),
+                          true));
 
-            if (!prefDate.empty())
-              format = prefDate;
-          }
-
-          // utc
-          bool isSet;
-          bool utc(configValue<bool>(scope, hdrClass, "utc", s_optional, &isSet));
-
-          // Store formatted datum
-          texts[HEADERhdrClass]
-              << (datetime.is_not_a_date_time()
-                      ? ""
-                      : svgescapetext(
-                            toFormattedString(datetime, format, isSet && utc, language).CharPtr(),
-                            true));
-
-          return;
-        }
-        else
-          throw std::runtime_error(confPath + ": '" + type + "'" + hdrtypeMsg);
-      }  // if
-    }    // for
+        return;
+      }
+      else
+        throw std::runtime_error(confPath + ": '" + type + "'" + hdrtypeMsg);
+    }
 
     if (options.debug)
     {
       // No (locale) settings for the header
       //
-      const char *p = ((hdrIdx < 0) ? "Settings for " : "Locale specific settings for ");
+      const char *p =
+          ((hdrScope->nameIdx < 0) ? "Settings for " : "Locale specific settings for ");
 
       debugoutput << p << hdrClass << " not found\n";
     }
@@ -1534,7 +1725,6 @@ void SvgRenderer::render_text(Texts &texts,
 {
   try
   {
-    const char *typeMsg = " must contain a list of groups in parenthesis";
     const char *styleMsg = ": slant must be 'normal', 'italic' or 'oblique'";
     const char *weightMsg = ": weight must be 'normal' or 'bold'";
 
@@ -1564,279 +1754,228 @@ void SvgRenderer::render_text(Texts &texts,
     if (text.empty())
       return;
 
-    const libconfig::Setting &textSpecs = config.lookup(confPath);
-    if (!textSpecs.isList())
-      throw std::runtime_error(confPath + typeMsg);
-
-    settings s_name((settings)(s_base + 0));
-
-    // Configuration blocks to search values for the settings; global blocks (blocks with no name
-    // and no locale),
-    // locale global blocks (blocks with matching name but having no locale and blocks having no
-    // name
-    // but with matching locale) and the current block (block with matching name and locale).
+    // Configuration blocks to search values for the settings; global blocks (blocks with no name)
+    // and the current block (block with matching name).
     //
     // The blocks are stored to the list in the order of appearance (and having current block
     // as the last element). The list is processed in reverse order when searching.
     //
-    // Current block or locale global block is needed for rendering.
+    // Current block or global block is needed for rendering.
     //
     // Note: Currently locale settings are not used.
 
-    std::list<const libconfig::Setting *> scope;
-    bool nameMatch, noName;
-    bool hasLocaleGlobals = false;
+    const ConfigScope *textScope = configResolver.scope(confPath, textName);
 
-    int textIdx = -1;
-    int lastIdx = textSpecs.getLength() - 1;
-
-    for (int i = 0; i <= lastIdx; ++i)
+    if (!textScope)
     {
-      const libconfig::Setting &specs = textSpecs[i];
-      if (!specs.isGroup())
-        throw std::runtime_error(confPath + typeMsg);
+      // No settings for confPath
+      //
+      if (options.debug)
+        debugoutput << "Settings for " << confPath << " (" << textName << ") not found\n";
 
-      try
-      {
-        noName = false;
-        nameMatch = (lookup<std::string>(specs, confPath, "name", s_name) == textName);
-      }
-      catch (SettingIdNotFoundException &ex)
-      {
-        // Global settings have no name; go on to check locale
-        //
-        noName = true;
-        nameMatch = false;
-      }
+      return;
+    }
 
-      // Enter the block on matching name, and for globals and last config entry
-      // to load/use the globals
-      //
+    std::list<const libconfig::Setting *> scope(textScope->scope);
+
+    if (!scope.empty())
+    {
       try
       {
-        if (nameMatch || noName || ((i == lastIdx) && hasLocaleGlobals))
-        {
-          if (nameMatch || noName)
-          {
-            if (nameMatch)
-              textIdx = i;
-
-            // Locale
-            //
-            // Currently locale settings are not used
-            //
-            std::string locale(
-                options
-                    .locale /*toLower(configValue<std::string>(specs,textName,"locale",nullptr,s_optional))*/);
-            bool localeMatch = (locale == options.locale);
+        // Font name
+        std::string font = configValue<std::string>(scope, textName, "font-family");
+
+        // Font size
+        int fSize = (fontSize && (*fontSize > 0))
+                        ? *fontSize
+                        : configValue<unsigned int>(scope, textName, "font-size");
+
+        // Font style
+        cairo_font_slant_t slant = CAIRO_FONT_SLANT_NORMAL;
+        std::string style = configValue<std::string>(scope, textName, "font-style", s_optional);
+
+        if (style == "italic")
+          slant = CAIRO_FONT_SLANT_ITALIC;
+        else if (style == "oblique")
+          slant = CAIRO_FONT_SLANT_OBLIQUE;
+        else if (style != "")
+          throw std::runtime_error(confPath + styleMsg);
+        else
+          style = "normal";
 
-            if (localeMatch || (locale == ""))
-            {
-              scope.push_back(&specs);
+        // Font weight
+        cairo_font_weight_t _weight = CAIRO_FONT_WEIGHT_NORMAL;
+        std::string weight = configValue<std::string>(scope, textName, "font-weight", s_optional);
 
-              if ((nameMatch && (locale == "")) || (noName && localeMatch))
-                hasLocaleGlobals = true;
-            }
+        if (weight == "bold")
+          _weight = CAIRO_FONT_WEIGHT_BOLD;
+        else if (weight != "")
+          throw std::runtime_error(confPath + weightMsg);
+        else
+          weight = "normal";
 
-            if ((noName || (!localeMatch)) && ((i < lastIdx) || (!hasLocaleGlobals)))
-              continue;
-          }
+        // Stroke and fill color
+        std::string stroke = configValue<std::string>(scope, textName, "stroke", s_optional);
+        std::string fill = configValue<std::string>(scope, textName, "fill", s_optional);
 
-          // Font name
-          std::string font = configValue<std::string>(scope, textName, "font-family");
+        // Max width, height, x/y margin and x/y offsets
+        //
+        // For area/symbol text (when tXOffset and tYOffset are passed in as nonnull) the offsets
+        // are used later
+        // when setting the final text position.
+        //
+        // Note: If the passed offsets (or font size) are nonzero, they were set in the text and
+        // won't be overridden by config settings.
+        unsigned int maxWidth = ((maxTextWidth && (*maxTextWidth > 0))
+                                     ? *maxTextWidth
+                                     : configValue<unsigned int>(scope, textName, "textwidth"));
+
+        bool isSet;
+        unsigned int maxHeight =
+            configValue<unsigned int>(scope, textName, "textheight", s_optional, &isSet);
+        if (!isSet)
+          maxHeight = 0;
+
+        unsigned int margin =
+            configValue<unsigned int>(scope, textName, "margin", s_optional, &isSet);
+        if (!isSet)
+          margin = 2;
+
+        if (maxWidth <= 20)
+          maxWidth = 20;
+        if ((maxHeight != 0) && (maxHeight <= 20))
+          maxHeight = 20;
+
+        int xOffset = configValue<int>(scope, textName, "txoffset", s_optional, &isSet);
+        if ((!isSet) || tXOffset)
+        {
+          if (isSet && (*tXOffset == 0))
+            *tXOffset = xOffset;
 
-          // Font size
-          int fSize = (fontSize && (*fontSize > 0))
-                          ? *fontSize
-                          : configValue<unsigned int>(scope, textName, "font-size");
+          xOffset = 0;
+        }
 
-          // Font style
-          cairo_font_slant_t slant = CAIRO_FONT_SLANT_NORMAL;
-          std::string style = configValue<std::string>(scope, textName, "font-style", s_optional);
+        int yOffset = configValue<int>(scope, textName, "tyoffset", s_optional, &isSet);
+        if ((!isSet) || tYOffset)
+        {
+          if (isSet && (*tYOffset == 0))
+            *tYOffset = yOffset;
 
-          if (style == "italic")
-            slant = CAIRO_FONT_SLANT_ITALIC;
-          else if (style == "oblique")
-            slant = CAIRO_FONT_SLANT_OBLIQUE;
-          else if (style != "")
-            throw std::runtime_error(confPath + styleMsg);
-          else
-            style = "normal";
+          yOffset = 0;
+        }
 
-          // Font weight
-          cairo_font_weight_t _weight = CAIRO_FONT_WEIGHT_NORMAL;
-          std::string weight = configValue<std::string>(scope, textName, "font-weight", s_optional);
+        // Settings for background; style and x/y offsets for top left corner
 
-          if (weight == "bold")
-            _weight = CAIRO_FONT_WEIGHT_BOLD;
-          else if (weight != "")
-            throw std::runtime_error(confPath + weightMsg);
-          else
-            weight = "normal";
+        std::string bStyle = configValue<std::string>(scope, textName, "bstyle", s_optional);
 
-          // Stroke and fill color
-          std::string stroke = configValue<std::string>(scope, textName, "stroke", s_optional);
-          std::string fill = configValue<std::string>(scope, textName, "fill", s_optional);
+        int bXOffset = configValue<int>(scope, textName, "bxoffset", s_optional, &isSet);
+        if (!isSet)
+          bXOffset = 0;
 
-          // Max width, height, x/y margin and x/y offsets
-          //
-          // For area/symbol text (when tXOffset and tYOffset are passed in as nonnull) the offsets
-          // are used later
-          // when setting the final text position.
-          //
-          // Note: If the passed offsets (or font size) are nonzero, they were set in the text and
-          // won't be overridden by config settings.
-          unsigned int maxWidth = ((maxTextWidth && (*maxTextWidth > 0))
-                                       ? *maxTextWidth
-                                       : configValue<unsigned int>(scope, textName, "textwidth"));
+        int bYOffset = configValue<int>(scope, textName, "byoffset", s_optional, &isSet);
+        if (!isSet)
+          bYOffset = 0;
 
-          bool isSet;
-          unsigned int maxHeight =
-              configValue<unsigned int>(scope, textName, "textheight", s_optional, &isSet);
-          if (!isSet)
-            maxHeight = 0;
-
-          unsigned int margin =
-              configValue<unsigned int>(scope, textName, "margin", s_optional, &isSet);
-          if (!isSet)
-            margin = 2;
-
-          if (maxWidth <= 20)
-            maxWidth = 20;
-          if ((maxHeight != 0) && (maxHeight <= 20))
-            maxHeight = 20;
-
-          int xOffset = configValue<int>(scope, textName, "txoffset", s_optional, &isSet);
-          if ((!isSet) || tXOffset)
-          {
-            if (isSet && (*tXOffset == 0))
-              *tXOffset = xOffset;
+        // Split the text into lines using given max. width and height
 
-            xOffset = 0;
-          }
+        std::list<std::string> textLines;
+        unsigned int textWidth, textHeight, maxLineHeight;
 
-          int yOffset = configValue<int>(scope, textName, "tyoffset", s_optional, &isSet);
-          if ((!isSet) || tYOffset)
-          {
-            if (isSet && (*tYOffset == 0))
-              *tYOffset = yOffset;
+        getTextLines(text,
+                     font,
+                     fSize,
+                     slant,
+                     _weight,
+                     maxWidth,
+                     maxHeight,
+                     textLines,
+                     textWidth,
+                     textHeight,
+                     maxLineHeight);
 
-            yOffset = 0;
-          }
+        xPosW = (2 * margin) + textWidth;
 
-          // Settings for background; style and x/y offsets for top left corner
+        // Store the css class definition
+        //
+        // Note: Generating css class for each area infotext; the settings can differ
 
-          std::string bStyle = configValue<std::string>(scope, textName, "bstyle", s_optional);
+        std::string textClass("text" + ((TEXTPOSid.empty() || useTextName)
+                                            ? textName
+                                            : TEXTPOSid.substr(TEXTPOSid.find("_") + 1)));
 
-          int bXOffset = configValue<int>(scope, textName, "bxoffset", s_optional, &isSet);
-          if (!isSet)
-            bXOffset = 0;
+        if (texts[TEXTCLASStextName].str().empty())
+        {
+          texts[TEXTCLASStextName] << "." << textClass << " {\nfont-family: " << font
+                                   << ";\nfont-size: " << fSize << "px;\nfont-weight : " << weight
+                                   << ";\nfont-style : " << style;
 
-          int bYOffset = configValue<int>(scope, textName, "byoffset", s_optional, &isSet);
-          if (!isSet)
-            bYOffset = 0;
+          if (!stroke.empty())
+            texts[TEXTCLASStextName] << ";\nstroke: " << stroke;
+          if (!fill.empty())
+            texts[TEXTCLASStextName] << ";\nfill: " << fill;
 
-          // Split the text into lines using given max. width and height
+          texts[TEXTCLASStextName] << ";\n}\n";
+        }
 
-          std::list<std::string> textLines;
-          unsigned int textWidth, textHeight, maxLineHeight;
+        int x = startX - xOffset - (centerToStartX ? ((textWidth / 2) + margin) : 0);
+        int y = startY + yOffset;
 
-          getTextLines(text,
-                       font,
-                       fSize,
-                       slant,
-                       _weight,
-                       maxWidth,
-                       maxHeight,
-                       textLines,
-                       textWidth,
-                       textHeight,
-                       maxLineHeight);
+        // Offset is decremented from last line's y -coordinate to get text's height
 
-          xPosW = (2 * margin) + textWidth;
+        yPosH = -y;
 
-          // Store the css class definition
+        if (setTextArea)
+        {
+          // Store geometry for text border
           //
-          // Note: Generating css class for each area infotext; the settings can differ
+          texts[TEXTAREAtextName].str("");
+          texts[TEXTAREAtextName].clear();
 
-          std::string textClass("text" + ((TEXTPOSid.empty() || useTextName)
-                                              ? textName
-                                              : TEXTPOSid.substr(TEXTPOSid.find("_") + 1)));
-
-          if (texts[TEXTCLASStextName].str().empty())
-          {
-            texts[TEXTCLASStextName] << "." << textClass << " {\nfont-family: " << font
-                                     << ";\nfont-size: " << fSize << "px;\nfont-weight : " << weight
-                                     << ";\nfont-style : " << style;
-
-            if (!stroke.empty())
-              texts[TEXTCLASStextName] << ";\nstroke: " << stroke;
-            if (!fill.empty())
-              texts[TEXTCLASStextName] << ";\nfill: " << fill;
-
-            texts[TEXTCLASStextName] << ";\n}\n";
-          }
+          texts[TEXTAREAtextName] << " x=\"" << x << "\" y=\"" << y << "\" width=\"" << xPosW;
+        }
 
-          int x = startX - xOffset - (centerToStartX ? ((textWidth / 2) + margin) : 0);
-          int y = startY + yOffset;
+        // Store the text
 
-          // Offset is decremented from last line's y -coordinate to get text's height
+        std::list<std::string>::const_iterator it = textLines.begin();
 
-          yPosH = -y;
+        for (x += margin, y += margin; (it != textLines.end()); it++)
+        {
+          y += maxLineHeight;
 
-          if (setTextArea)
+          if (it == textLines.begin())
           {
-            // Store geometry for text border
-            //
-            texts[TEXTAREAtextName].str("");
-            texts[TEXTAREAtextName].clear();
+            if (!TEXTPOSid.empty())
+              // Set transformation data.
+              //
+              // Note: Scaling placeholder/value might not get set; unset placehoders will be
+              // removed prior output
+              //
+              texts[TEXTtextName] << "<g transform=\"translate(--" << TEXTPOSid << "--) --"
+                                  << TEXTPOSid << "SCALE--\">\n";
 
-            texts[TEXTAREAtextName] << " x=\"" << x << "\" y=\"" << y << "\" width=\"" << xPosW;
+            if (!bStyle.empty())
+              // Set background
+              //
+              texts[TEXTtextName] << "<rect width=\"" << textWidth - (2 * bXOffset)
+                                  << "\" height=\"" << textHeight - (2 * bYOffset) << "\" x=\""
+                                  << bXOffset << "\" y=\"" << bYOffset << "\" style=\"" << bStyle
+                                  << "\""
+                                  << "/>";
           }
 
-          // Store the text
-
-          std::list<std::string>::const_iterator it = textLines.begin();
-
-          for (x += margin, y += margin; (it != textLines.end()); it++)
-          {
-            y += maxLineHeight;
-
-            if (it == textLines.begin())
-            {
-              if (!TEXTPOSid.empty())
-                // Set transformation data.
-                //
-                // Note: Scaling placeholder/value might not get set; unset placehoders will be
-                // removed prior output
-                //
-                texts[TEXTtextName] << "<g transform=\"translate(--" << TEXTPOSid << "--) --"
-                                    << TEXTPOSid << "SCALE--\">\n";
-
-              if (!bStyle.empty())
-                // Set background
-                //
-                texts[TEXTtextName] << "<rect width=\"" << textWidth - (2 * bXOffset)
-                                    << "\" height=\"" << textHeight - (2 * bYOffset) << "\" x=\""
-                                    << bXOffset << "\" y=\"" << bYOffset << "\" style=\"" << bStyle
-                                    << "\""
-                                    << "/>";
-            }
-
-            texts[TEXTtextName] << "<text class=\"" << textClass << "\" x=\"" << x << "\" y=\"" << y
-                                << "\">" << svgescapetext(*it) << "</text>\n";
-          }
+          texts[TEXTtextName] << "<text class=\"" << textClass << "\" x=\"" << x << "\" y=\"" << y
+                              << "\">" << svgescapetext(*it) << "</text>\n";
+        }
 
-          yPosH += (y + margin);
-          yPosH /= textHeightFactor;
+        yPosH += (y + margin);
+        yPosH /= textHeightFactor;
 
-          if (!TEXTPOSid.empty())
-            texts[TEXTtextName] << "</g>\n";
-          else if (setTextArea)
-            texts[TEXTAREAtextName] << "\" height=\"" << yPosH << "\" ";
+        if (!TEXTPOSid.empty())
+          texts[TEXTtextName] << "</g>\n";
+        else if (setTextArea)
+          texts[TEXTAREAtextName] << "\" height=\"" << yPosH << "\" ";
 
-          return;
-        }  // if
+        return;
       }
       catch (...)
       {
@@ -1845,13 +1984,14 @@ void SvgRenderer::render_text(Texts &texts,
 
         throw;
       }
-    }  // for
+    }
 
     if (options.debug)
     {
       // No (locale) settings for the text
       //
-      const char *p = ((textIdx < 0) ? "Settings for " : "Locale specific settings for ");
+      const char *p =
+          ((textScope->nameIdx < 0) ? "Settings for " : "Locale specific settings for ");
 
       debugoutput << p << textName << " not found\n";
     }
@@ -2078,15 +2218,8 @@ void SvgRenderer::render_surface(
 
   try
   {
-    const char *typeMsg = " must contain a list of groups in parenthesis";
     const char *surfTypeMsg = ": surface type must be 'pattern', 'mask', 'glyph' or 'svg'";
 
-    const libconfig::Setting &surfSpecs = config.lookup(confPath);
-    if (!surfSpecs.isList())
-      throw std::runtime_error(confPath + typeMsg);
-
-    settings s_name((settings)(s_base + 0));
-
     // Configuration blocks to search values for the settings; global blocks (blocks with no name)
     // and the current block with matching name.
     //
@@ -2095,584 +2228,564 @@ void SvgRenderer::render_surface(
     //
     // Current block or global block is needed for rendering.
 
-    std::list<const libconfig::Setting *> scope;
-    bool nameMatch, noName;
+    const ConfigScope *surfScope = configResolver.scope(confPath, surfaceName);
+
+    if (!surfScope)
+    {
+      // No settings for confPath
+      //
+      if (options.debug)
+        debugoutput << "Settings for " << confPath << " (" << surfaceName << ") not found\n";
+
+      return;
+    }
 
-    int surfIdx = -1;
-    int lastIdx = surfSpecs.getLength() - 1;
+    std::list<const libconfig::Setting *> scope(surfScope->scope);
 
-    for (int i = 0; i <= lastIdx; ++i)
+    if (!scope.empty())
     {
-      const libconfig::Setting &specs = surfSpecs[i];
-      if (!specs.isGroup())
-        throw std::runtime_error(confPath + typeMsg);
+      // Clipping and optional simplification of the path (tolerance in pixels)
 
-      try
-      {
-        noName = false;
-        nameMatch = (lookup<std::string>(specs, confPath, "name", s_name) == surfaceName);
-      }
-      catch (SettingIdNotFoundException &ex)
-      {
-        // Global settings have no name
-        //
-        noName = true;
-        nameMatch = false;
-      }
+      clipToArea(path);
+      path.simplify(configValue<double, int>(scope, surfaceName, "simplify", s_optional));
 
-      // Enter the block on matching name, and for globals and last config entry
-      // to load/use the globals
-      //
-      if (nameMatch || noName || ((i == lastIdx) && (!scope.empty())))
-      {
-        if (nameMatch || noName)
-        {
-          if (nameMatch)
-            surfIdx = i;
+      // Surface type; pattern, mask, glyph or svg
 
-          scope.push_back(&specs);
+      std::string type = configValue<std::string>(scope, surfaceName, "type");
+      bool filled = ((type == "fill") || (type == "fill+mask"));
+      bool masked = ((type == "mask") || (type == "fill+mask"));
 
-          if (noName && (i < lastIdx))
-            continue;
-        }
+      if ((type == "pattern") || (type == "glyph") || filled || masked)
+      {
+        // Class and style
+        //
+        std::string classDef(
+            (type != "pattern") ? configValue<std::string>(scope, surfaceName, "class") : "");
+        std::string style((type != "fill") ? configValue<std::string>(scope, surfaceName, "style")
+                                           : "");
 
-        // Surface type; pattern, mask, glyph or svg
+        // Output placeholder; by default output to passed stream
 
-        std::string type = configValue<std::string>(scope, surfaceName, "type");
-        bool filled = ((type == "fill") || (type == "fill+mask"));
-        bool masked = ((type == "mask") || (type == "fill+mask"));
+        std::string placeHolder(boost::algorithm::trim_copy(
+            configValue<std::string>(scope, surfaceName, "output", s_optional)));
+        std::ostringstream &surfaces = (placeHolder.empty() ? surfaceOutput : texts[placeHolder]);
 
-        if ((type == "pattern") || (type == "glyph") || filled || masked)
+        if (type == "pattern")
+          surfaces << "<g id=\"" << id << "\">\n"
+                   << "<path style=\"" << style << "\" d=\"" << svgPath(path) << "\"/>\n"
+                   << "</g>\n";
+        else
         {
-          // Class and style
-          //
-          std::string classDef(
-              (type != "pattern") ? configValue<std::string>(scope, surfaceName, "class") : "");
-          std::string style((type != "fill") ? configValue<std::string>(scope, surfaceName, "style")
-                                             : "");
+          std::string pathId(id + type);
 
-          // Output placeholder; by default output to passed stream
+          paths << "<path id=\"" << pathId << "\" d=\"" << svgPath(path) << "\"/>\n";
 
-          std::string placeHolder(boost::algorithm::trim_copy(
-              configValue<std::string>(scope, surfaceName, "output", s_optional)));
-          std::ostringstream &surfaces = (placeHolder.empty() ? surfaceOutput : texts[placeHolder]);
+          surfaces << "<use class=\"" << classDef << "\" xlink:href=\"#" << pathId
+                   << ((filled && (!masked)) ? "\"/>\n" : "");
 
-          if (type == "pattern")
-            surfaces << "<g id=\"" << id << "\">\n"
-                     << "<path style=\"" << style << "\" d=\"" << path.svg() << "\"/>\n"
-                     << "</g>\n";
-          else
+          if (masked)
           {
-            std::string pathId(id + type);
+            std::string maskId(pathId + "mask");
 
-            paths << "<path id=\"" << pathId << "\" d=\"" << path.svg() << "\"/>\n";
+            masks << "<mask id=\"" << maskId << "\" maskUnits=\"userSpaceOnUse\">\n"
+                  << "<use xlink:href=\"#" << pathId << "\" class=\"" << style
+                  << "\"/>\n</mask>\n";
 
-            surfaces << "<use class=\"" << classDef << "\" xlink:href=\"#" << pathId
-                     << ((filled && (!masked)) ? "\"/>\n" : "");
+            surfaces << "\" mask=\"url(#" << maskId << ")\"/>\n";
+          }
 
-            if (masked)
-            {
-              std::string maskId(pathId + "mask");
+          if (filled)
+          {
+            // Fill symbol width and height and scale factor for bounding box for
+            // calculating suitable symbol positions
+            //
+            int _width = configValue<int>(scope, surfaceName, "width");
+            int _height = configValue<int>(scope, surfaceName, "height");
+            float _scale = configValue<float>(scope, surfaceName, "scale");
 
-              masks << "<mask id=\"" << maskId << "\" maskUnits=\"userSpaceOnUse\">\n"
-                    << "<use xlink:href=\"#" << pathId << "\" class=\"" << style
-                    << "\"/>\n</mask>\n";
+            if (_scale < symbolBBoxFactorMin)
+              throw std::runtime_error(confPath + ": minimum scale is " +
+                                       Fmi::to_string(symbolBBoxFactorMin));
 
-              surfaces << "\" mask=\"url(#" << maskId << ")\"/>\n";
-            }
+            // If autoscale is true (default: false) symbol is shrinken until
+            // at least one symbol or all area symbols can be placed on the surface
+            bool isSet;
+            bool autoScale =
+                configValue<bool>(scope, surfaceName, "autoscale", s_optional, &isSet);
+            if (!isSet)
+              autoScale = false;
+
+            // If mode is 'vertical' (default: horizontal) the symbols are placed using y -axis as
+            // the
+            // primary axis (using maximum vertical fillrects instead of maximum horizontal
+            // fillrects)
+            std::string mode = configValue<std::string>(scope, surfaceName, "mode", s_optional);
+            bool verticalRects = (mode == "vertical");
+
+            // If direction is 'both' (default: up) iterating vertically over the surface
+            // y-coordinates
+            // from both directions; otherwise from bottom up
+            std::string direction =
+                configValue<std::string>(scope, surfaceName, "direction", s_optional);
+            bool scanUpDown = (direction == "both");
+
+            // If showareas is true (default: false) output the fill area bounding boxes too
+            bool showAreas =
+                configValue<bool>(scope, surfaceName, "showareas", s_optional, &isSet);
+            if (!isSet)
+              showAreas = false;
 
-            if (filled)
+            // Get mapping for ParameterValueSetArea's symbols; code_<symCode> = <code>
+
+            std::list<std::string> fillSymbols;
+
+            if (areaSymbols)
             {
-              // Fill symbol width and height and scale factor for bounding box for
-              // calculating suitable symbol positions
-              //
-              int _width = configValue<int>(scope, surfaceName, "width");
-              int _height = configValue<int>(scope, surfaceName, "height");
-              float _scale = configValue<float>(scope, surfaceName, "scale");
-
-              if (_scale < symbolBBoxFactorMin)
-                throw std::runtime_error(confPath + ": minimum scale is " +
-                                         Fmi::to_string(symbolBBoxFactorMin));
-
-              // If autoscale is true (default: false) symbol is shrinken until
-              // at least one symbol or all area symbols can be placed on the surface
-              bool isSet;
-              bool autoScale =
-                  configValue<bool>(scope, surfaceName, "autoscale", s_optional, &isSet);
-              if (!isSet)
-                autoScale = false;
-
-              // If mode is 'vertical' (default: horizontal) the symbols are placed using y -axis as
-              // the
-              // primary axis (using maximum vertical fillrects instead of maximum horizontal
-              // fillrects)
-              std::string mode = configValue<std::string>(scope, surfaceName, "mode", s_optional);
-              bool verticalRects = (mode == "vertical");
-
-              // If direction is 'both' (default: up) iterating vertically over the surface
-              // y-coordinates
-              // from both directions; otherwise from bottom up
-              std::string direction =
-                  configValue<std::string>(scope, surfaceName, "direction", s_optional);
-              bool scanUpDown = (direction == "both");
-
-              // If showareas is true (default: false) output the fill area bounding boxes too
-              bool showAreas =
-                  configValue<bool>(scope, surfaceName, "showareas", s_optional, &isSet);
-              if (!isSet)
-                showAreas = false;
-
-              // Get mapping for ParameterValueSetArea's symbols; code_<symCode> = <code>
-
-              std::list<std::string> fillSymbols;
-
-              if (areaSymbols)
-              {
-                std::list<std::string>::const_iterator sym = areaSymbols->begin();
-                std::string code;
+              std::list<std::string>::const_iterator sym = areaSymbols->begin();
+              std::string code;
 
-                for (; (sym != areaSymbols->end()); sym++)
-                  if (symbolMapping(config, confPath, "code_" + *sym, s_optional, code, &scope))
-                    fillSymbols.push_back(code);
+              for (; (sym != areaSymbols->end()); sym++)
+                if (symbolMapping(config, confPath, "code_" + *sym, s_optional, code, &scope))
+                  fillSymbols.push_back(code);
 
-                if (fillSymbols.size() < areaSymbols->size())
-                {
-                }
+              if (fillSymbols.size() < areaSymbols->size())
+              {
               }
+            }
 
-              NFmiFillRect infoTextRect(std::make_pair(Point(1, 1), Point(0, 0)));
-              const std::string &infoText = (feature ? feature->text(options.locale) : "");
-              std::string TEXTPOSid("Z0TEXTPOS_" + id), textPosition;
-              int areaWidth = static_cast<int>(std::floor(0.5 + area->Width()));
-              int areaHeight = static_cast<int>(std::floor(0.5 + area->Height()));
-              int textWidth = 0, textHeight = 0, maxTextWidth = 0, fontSize = 0, tXOffset = 0,
-                  tYOffset = 0;
+            NFmiFillRect infoTextRect(std::make_pair(Point(1, 1), Point(0, 0)));
+            const std::string &infoText = (feature ? feature->text(options.locale) : "");
+            std::string TEXTPOSid("Z0TEXTPOS_" + id), textPosition;
+            int areaWidth = static_cast<int>(std::floor(0.5 + area->Width()));
+            int areaHeight = static_cast<int>(std::floor(0.5 + area->Height()));
+            int textWidth = 0, textHeight = 0, maxTextWidth = 0, fontSize = 0, tXOffset = 0,
+                tYOffset = 0;
 
-              if ((!infoText.empty()) && (infoText != options.locale))
+            if ((!infoText.empty()) && (infoText != options.locale))
+            {
+              // Render feature's infotext. The text is rendered starting from coordinate (0,0)
+              // and
+              // final position is selected afterwards. The final position is set as
+              // transformation
+              // offsets to the selected position.
+              //
+              // Note: The key for position must sort after the key for the text (the key/text
+              //		 containing the position key must be handled/outputted prior the
+              // position key/text);
+              //		 therefore the position key starts with "Z0"
+              //
+              std::string textOut(boost::algorithm::trim_copy(infoText));
+
+              textPosition =
+                  configValue<std::string>(scope, surfaceName, "textposition", s_optional);
+
+              // The text can start with position, fontsize and x/y offset settings overriding the
+              // configured values.
+
+              textSettings(textOut, textPosition, maxTextWidth, fontSize, tXOffset, tYOffset);
+
+              render_text(texts,
+                          confPath,
+                          surfaceName,
+                          NFmiStringTools::UrlDecode(textOut),
+                          textWidth,
+                          textHeight,
+                          true,
+                          false,
+                          false,
+                          TEXTPOSid,
+                          false,
+                          &maxTextWidth,
+                          &fontSize,
+                          &tXOffset,
+                          &tYOffset);
+
+              if (textPosition == "area")
               {
-                // Render feature's infotext. The text is rendered starting from coordinate (0,0)
-                // and
-                // final position is selected afterwards. The final position is set as
-                // transformation
-                // offsets to the selected position.
+                // Get text position within the area
                 //
-                // Note: The key for position must sort after the key for the text (the key/text
-                //		 containing the position key must be handled/outputted prior the
-                // position key/text);
-                //		 therefore the position key starts with "Z0"
-                //
-                std::string textOut(boost::algorithm::trim_copy(infoText));
-
-                textPosition =
-                    configValue<std::string>(scope, surfaceName, "textposition", s_optional);
-
-                // The text can start with position, fontsize and x/y offset settings overriding the
-                // configured values.
-
-                textSettings(textOut, textPosition, maxTextWidth, fontSize, tXOffset, tYOffset);
-
-                render_text(texts,
-                            confPath,
-                            surfaceName,
-                            NFmiStringTools::UrlDecode(textOut),
-                            textWidth,
-                            textHeight,
-                            true,
-                            false,
-                            false,
-                            TEXTPOSid,
-                            false,
-                            &maxTextWidth,
-                            &fontSize,
-                            &tXOffset,
-                            &tYOffset);
-
-                if (textPosition == "area")
-                {
-                  // Get text position within the area
+                NFmiFillMap fmap;
+                NFmiFillAreas areas;
+                path.length(&fmap);
+
+                if (fmap.getFillAreas(areaWidth,
+                                      areaHeight,
+                                      textWidth,
+                                      textHeight,
+                                      1.0,
+                                      verticalRects,
+                                      areas,
+                                      false,
+                                      scanUpDown))
+                  infoTextRect = getCenterFillAreaRect(areas, textWidth, 1.0);
+                else
+                  // No room within the area, using the defaut location
                   //
-                  NFmiFillMap fmap;
-                  NFmiFillAreas areas;
-                  path.length(&fmap);
-
-                  if (fmap.getFillAreas(areaWidth,
-                                        areaHeight,
-                                        textWidth,
-                                        textHeight,
-                                        1.0,
-                                        verticalRects,
-                                        areas,
-                                        false,
-                                        scanUpDown))
-                    infoTextRect = getCenterFillAreaRect(areas, textWidth, 1.0);
-                  else
-                    // No room within the area, using the defaut location
-                    //
-                    textPosition.clear();
-                }
+                  textPosition.clear();
               }
+            }
 
-              // Get symbol fill areas.
-              //
-              // If none available or not enough room for all area symbols, and autoscale is set,
-              // retry with smaller symbol size. If still not enough room, retry without placing the
-              // infotext into the area, by using smaller symbol bbox and by scaling the surface
-              // bigger
-              //
-              NFmiFillMap fmap;
-              NFmiFillAreas areas;
-              NFmiFillPositions fpos;
-              path.length(&fmap);
-
-              int width = _width;
-              int height = _height;
-              double scale = _scale;
-              size_t pathScalingOffset = 0;
-              bool noTextRetry = false, isScaled = true, sizeOk, ok;
-
-              // If symbol bounding box (spacing) is increased, first scale up the surface to get
-              // the outermost symbols positioned near enough the surface border.
-              //
-              // The scaled surface will not be rendered, it is used only to get fill areas.
+            // Get symbol fill areas.
+            //
+            // If none available or not enough room for all area symbols, and autoscale is set,
+            // retry with smaller symbol size. If still not enough room, retry without placing the
+            // infotext into the area, by using smaller symbol bbox and by scaling the surface
+            // bigger
+            //
+            NFmiFillMap fmap;
+            NFmiFillAreas areas;
+            NFmiFillPositions fpos;
+            path.length(&fmap);
+
+            int width = _width;
+            int height = _height;
+            double scale = _scale;
+            size_t pathScalingOffset = 0;
+            bool noTextRetry = false, isScaled = true, sizeOk, ok;
+
+            // If symbol bounding box (spacing) is increased, first scale up the surface to get
+            // the outermost symbols positioned near enough the surface border.
+            //
+            // The scaled surface will not be rendered, it is used only to get fill areas.
 
-              if ((scale >= 1) && autoScale)
-              {
-                pathScalingOffset = (((scale - 1.0) * 30) + 12);
+            if ((scale >= 1) && autoScale)
+            {
+              pathScalingOffset = (((scale - 1.0) * 30) + 12);
 
-                if ((isScaled = path.scale(
-                         std::min(pathScalingOffset, (pathScalingSymbolHeightFactorMax * height)),
-                         path)))
-                {
-                  NFmiFillMap fmapScaled;
+              if ((isScaled = path.scale(
+                       std::min(pathScalingOffset, (pathScalingSymbolHeightFactorMax * height)),
+                       path)))
+              {
+                NFmiFillMap fmapScaled;
 
-                  path.length(&fmapScaled);
-                  fmap = fmapScaled;
-                }
+                path.length(&fmapScaled);
+                fmap = fmapScaled;
               }
+            }
 
+            do
+            {
               do
               {
-                do
+                areas.clear();
+
+                ok = sizeOk = fmap.getFillAreas(areaWidth,
+                                                areaHeight,
+                                                width,
+                                                height,
+                                                scale,
+                                                verticalRects,
+                                                areas,
+                                                true,
+                                                scanUpDown);
+
+                if (ok && (fillSymbols.size() > 0))
                 {
-                  areas.clear();
-
-                  ok = sizeOk = fmap.getFillAreas(areaWidth,
-                                                  areaHeight,
-                                                  width,
-                                                  height,
-                                                  scale,
-                                                  verticalRects,
-                                                  areas,
-                                                  true,
-                                                  scanUpDown);
-
-                  if (ok && (fillSymbols.size() > 0))
-                  {
-                    // Check there is room for all area symbols. Erase fill areas overlapping the
-                    // area
-                    // reserved for info text.
-                    //
-                    // Note: To get fillareas with width near or equal to twice (etc) the symbol
-                    // width splitted, decreasing scale
-                    //		 slightly (this needs some checking/thinking later through)
-                    //
-                    splitFillAreas(areas, width, scale - 0.1);
+                  // Check there is room for all area symbols. Erase fill areas overlapping the
+                  // area
+                  // reserved for info text.
+                  //
+                  // Note: To get fillareas with width near or equal to twice (etc) the symbol
+                  // width splitted, decreasing scale
+                  //		 slightly (this needs some checking/thinking later through)
+                  //
+                  splitFillAreas(areas, width, scale - 0.1);
 
-                    NFmiFillAreas::iterator iter;
-                    size_t symCnt = 0;
+                  NFmiFillAreas::iterator iter;
+                  size_t symCnt = 0;
 
-                    for (iter = areas.begin(), fpos.clear();
-                         ((iter != areas.end()) && (fpos.size() < fillSymbols.size()));)
-                      if (getFillPositions(iter, width, height, scale, infoTextRect, fpos, symCnt))
-                        iter++;
-                      else
-                        iter = areas.erase(iter);
+                  for (iter = areas.begin(), fpos.clear();
+                       ((iter != areas.end()) && (fpos.size() < fillSymbols.size()));)
+                    if (getFillPositions(iter, width, height, scale, infoTextRect, fpos, symCnt))
+                      iter++;
+                    else
+                      iter = areas.erase(iter);
 
-                    ok = (fpos.size() >= fillSymbols.size());
-                  }
+                  ok = (fpos.size() >= fillSymbols.size());
+                }
 
-                  if (!ok)
-                  {
-                    // Render infotext within the area only when all symbols fit in.
-                    //
-                    int nw = width - 2, nh = height - 2;
+                if (!ok)
+                {
+                  // Render infotext within the area only when all symbols fit in.
+                  //
+                  int nw = width - 2, nh = height - 2;
 
-                    sizeOk = ((nw >= floor(_width * markerScaleFactorMin)) &&
-                              (nh >= floor(_height * markerScaleFactorMin)));
-                    noTextRetry = false;
+                  sizeOk = ((nw >= floor(_width * markerScaleFactorMin)) &&
+                            (nh >= floor(_height * markerScaleFactorMin)));
+                  noTextRetry = false;
 
-                    if (sizeOk || (textPosition != "area"))
+                  if (sizeOk || (textPosition != "area"))
+                  {
+                    if (sizeOk)
                     {
-                      if (sizeOk)
-                      {
-                        // First trying with smaller symbol size
-                        //
-                        width = nw;
-                        height = nh;
-                      }
-                      else if ((fillSymbols.size() > 0) && (scale >= (symbolBBoxFactorMin + 0.1)))
-                        // Thirdly trying with smaller symbol bounding box, allowing (more) overlap
-                        //
-                        scale -= 0.1;
-                      else
-                        // Not enough room. Break the inner loop and scale up the surface
-                        //
-                        break;
+                      // First trying with smaller symbol size
+                      //
+                      width = nw;
+                      height = nh;
                     }
+                    else if ((fillSymbols.size() > 0) && (scale >= (symbolBBoxFactorMin + 0.1)))
+                      // Thirdly trying with smaller symbol bounding box, allowing (more) overlap
+                      //
+                      scale -= 0.1;
                     else
-                    {
-                      // Secondly trying without the infotext within the area
+                      // Not enough room. Break the inner loop and scale up the surface
                       //
-                      textPosition.clear();
-                      infoTextRect = std::make_pair(Point(0, 0), Point(0, 0));
-
-                      width = _width;
-                      height = _height;
-
-                      noTextRetry = true;
-                    }
+                      break;
                   }
-                } while ((autoScale || noTextRetry) && (!ok) && sizeOk);
-
-                if ((!ok) && autoScale && isScaled)
-                {
-                  // Scale up the surface
-                  //
-                  pathScalingOffset += 2;
-
-                  if ((pathScalingOffset <= (pathScalingSymbolHeightFactorMax * height)) &&
-                      (isScaled = path.scale(2, path)))
+                  else
                   {
-                    NFmiFillMap fmapScaled;
+                    // Secondly trying without the infotext within the area
+                    //
+                    textPosition.clear();
+                    infoTextRect = std::make_pair(Point(0, 0), Point(0, 0));
+
+                    width = _width;
+                    height = _height;
 
-                    path.length(&fmapScaled);
-                    fmap = fmapScaled;
+                    noTextRetry = true;
                   }
                 }
-              } while (autoScale && (!ok) && isScaled &&
-                       (pathScalingOffset <= (pathScalingSymbolHeightFactorMax * height)));
+              } while ((autoScale || noTextRetry) && (!ok) && sizeOk);
 
-              if (!ok)
+              if ((!ok) && autoScale && isScaled)
               {
-                if (!autoScale)
-                  throw std::runtime_error("render_surface: no space for symbol(s)");
-
-                // For warning areas fit max 4 symbols per fill area
+                // Scale up the surface
                 //
-                if ((fillSymbols.size() == 0) || ((4 * fpos.size()) < fillSymbols.size()))
-                {
-                  // Position fill symbol(s) to/around the center of area's bbox.
-                  //
-                  // Use the original symbol size for precipitation and single warning area symbol,
-                  // minimum size otherwise. Pack/overlap multiple (warning area) symbols.
-                  //
-                  Path::BBox bbox = path.getBBox();
-                  const double packingFactor = 0.5;
-                  double cx = bbox.blX + ((bbox.trX - bbox.blX) / 2),
-                         cy = bbox.blY + ((bbox.trY - bbox.blY) / 2), x0, y0;
-                  const int spacing = 2;
-                  int nx, ny, ns;
-
-                  scale = 1;
-
-                  if ((ns = (int)fillSymbols.size()) == 0)
-                  {
-                    nx = ny = 1;
-                    width = _width;
-                    height = _height;
-
-                    x0 = cx - (width / 2) - spacing;
-                    y0 = cy - (height / 2) - spacing;
-                  }
-                  else
-                  {
-                    nx = floor(sqrt(fillSymbols.size()));
-                    nx += (((nx * nx) < (int)fillSymbols.size()) ? 1 : 0);
-                    ny = (fillSymbols.size() / nx);
-                    ny += (((nx * ny) < (int)fillSymbols.size()) ? 1 : 0);
-                    width = _width * ((fillSymbols.size() == 1) ? 1 : markerScaleFactorMin);
-                    height = _height * ((fillSymbols.size() == 1) ? 1 : markerScaleFactorMin);
-
-                    x0 = cx - ((nx / 2.0) * width * packingFactor);
-                    y0 = cy - ((ny / 2.0) * height * packingFactor);
-                    x0 -= (((nx / 2) * spacing) + ((nx % 2) ? (spacing / 2.0) : 0));
-                    y0 -= (((ny / 2) * spacing) + ((ny % 2) ? (spacing / 2.0) : 0));
-                  }
+                pathScalingOffset += 2;
 
-                  for (int y = 0; ((y < ny) && (ns > 0)); y++)
-                    for (int x = 0; ((x < nx) && (ns > 0)); x++, ns--)
-                    {
-                      double x1 = x0 + (x * ((width * packingFactor) + spacing));
-                      double x2 = x1 + width;
-                      double y1 = y0 + (y * ((height * packingFactor) + spacing));
-                      double y2 = y1 + height;
+                if ((pathScalingOffset <= (pathScalingSymbolHeightFactorMax * height)) &&
+                    (isScaled = path.scale(2, path)))
+                {
+                  NFmiFillMap fmapScaled;
 
-                      areas.push_back(std::make_pair(Point(x1, y1), Point(x2, y2)));
-                    }
+                  path.length(&fmapScaled);
+                  fmap = fmapScaled;
                 }
               }
-              // if (pathScalingOffset > 0) {
-              // paths << "<path id=\""
-              //	  << pathId + "C"
-              //	  << "\" d=\"" << path.svg() << "\"/>\n";
-              //
-              // surfaces << "<use class=\""
-              //		 << classDef
-              //		 << "\" xlink:href=\"#"
-              //		 << pathId  + "C" << ((filled && (!masked)) ? "\"/>\n" : "");
-              //
-              // if (masked) {
-              //	std::string maskId(pathId + "Cmask");
-              //
-              //	masks << "<mask id=\""
-              //		  << maskId
-              //		  << "\" maskUnits=\"userSpaceOnUse\">\n"
-              //		  << "<use xlink:href=\"#"
-              //		  << pathId + "C"
-              //		  << "\" class=\""
-              //		  << style
-              //		  << "\"/>\n</mask>\n";
-              //
-              //	surfaces << "\" mask=\"url(#"
-              //			 << maskId
-              //			 << ")\"/>\n";
-              //}
-              //}
-
-              fpos.clear();
-
-              // Set final infotext position
-
-              if (!infoText.empty())
-                setTextPosition(path,
-                                TEXTPOSid,
-                                textPosition,
-                                infoTextRect,
-                                areaWidth,
-                                areaHeight,
-                                textWidth,
-                                textHeight,
-                                tXOffset,
-                                tYOffset);
-
-              // Get symbol positions withing the fill areas
+            } while (autoScale && (!ok) && isScaled &&
+                     (pathScalingOffset <= (pathScalingSymbolHeightFactorMax * height)));
 
-              const char *clrs[] = {"red", "blue", "green", "orange", "brown", "yellow"};
-              size_t symCnt = 0, clrCnt = (sizeof(clrs) / sizeof(char *)), clrIdx = 0;
+            if (!ok)
+            {
+              if (!autoScale)
+                throw std::runtime_error("render_surface: no space for symbol(s)");
 
-              if (!areaSymbols || (areas.size() < 2))
+              // For warning areas fit max 4 symbols per fill area
+              //
+              if ((fillSymbols.size() == 0) || ((4 * fpos.size()) < fillSymbols.size()))
               {
-                for (NFmiFillAreas::const_iterator iter = areas.begin(); (iter != areas.end());
-                     iter++)
+                // Position fill symbol(s) to/around the center of area's bbox.
+                //
+                // Use the original symbol size for precipitation and single warning area symbol,
+                // minimum size otherwise. Pack/overlap multiple (warning area) symbols.
+                //
+                Path::BBox bbox = path.getBBox();
+                const double packingFactor = 0.5;
+                double cx = bbox.blX + ((bbox.trX - bbox.blX) / 2),
+                       cy = bbox.blY + ((bbox.trY - bbox.blY) / 2), x0, y0;
+                const int spacing = 2;
+                int nx, ny, ns;
+
+                scale = 1;
+
+                if ((ns = (int)fillSymbols.size()) == 0)
+                {
+                  nx = ny = 1;
+                  width = _width;
+                  height = _height;
+
+                  x0 = cx - (width / 2) - spacing;
+                  y0 = cy - (height / 2) - spacing;
+                }
+                else
                 {
-                  getFillPositions(iter, width, height, scale, infoTextRect, fpos, symCnt);
+                  nx = floor(sqrt(fillSymbols.size()));
+                  nx += (((nx * nx) < (int)fillSymbols.size()) ? 1 : 0);
+                  ny = (fillSymbols.size() / nx);
+                  ny += (((nx * ny) < (int)fillSymbols.size()) ? 1 : 0);
+                  width = _width * ((fillSymbols.size() == 1) ? 1 : markerScaleFactorMin);
+                  height = _height * ((fillSymbols.size() == 1) ? 1 : markerScaleFactorMin);
+
+                  x0 = cx - ((nx / 2.0) * width * packingFactor);
+                  y0 = cy - ((ny / 2.0) * height * packingFactor);
+                  x0 -= (((nx / 2) * spacing) + ((nx % 2) ? (spacing / 2.0) : 0));
+                  y0 -= (((ny / 2) * spacing) + ((ny % 2) ? (spacing / 2.0) : 0));
+                }
 
-                  if (showAreas)
+                for (int y = 0; ((y < ny) && (ns > 0)); y++)
+                  for (int x = 0; ((x < nx) && (ns > 0)); x++, ns--)
                   {
-                    // Draw fill area rects
-                    //
-                    surfaces << "<rect x=\"" << iter->first.x << "\" y=\"" << iter->first.y
-                             << "\" width=\"" << iter->second.x - iter->first.x << "\" height=\""
-                             << iter->second.y - iter->first.y << "\" fill=\""
-                             << clrs[clrIdx % clrCnt] << "\"/>\n";
-                    clrIdx++;
+                    double x1 = x0 + (x * ((width * packingFactor) + spacing));
+                    double x2 = x1 + width;
+                    double y1 = y0 + (y * ((height * packingFactor) + spacing));
+                    double y2 = y1 + height;
+
+                    areas.push_back(std::make_pair(Point(x1, y1), Point(x2, y2)));
                   }
-                }
               }
-              else if (fillSymbols.size() > 0)
+            }
+            // if (pathScalingOffset > 0) {
+            // paths << "<path id=\""
+            //	  << pathId + "C"
+            //	  << "\" d=\"" << path.svg() << "\"/>\n";
+            //
+            // surfaces << "<use class=\""
+            //		 << classDef
+            //		 << "\" xlink:href=\"#"
+            //		 << pathId  + "C" << ((filled && (!masked)) ? "\"/>\n" : "");
+            //
+            // if (masked) {
+            //	std::string maskId(pathId + "Cmask");
+            //
+            //	masks << "<mask id=\""
+            //		  << maskId
+            //		  << "\" maskUnits=\"userSpaceOnUse\">\n"
+            //		  << "<use xlink:href=\"#"
+            //		  << pathId + "C"
+            //		  << "\" class=\""
+            //		  << style
+            //		  << "\"/>\n</mask>\n";
+            //
+            //	surfaces << "\" mask=\"url(#"
+            //			 << maskId
+            //			 << ")\"/>\n";
+            //}
+            //}
+
+            fpos.clear();
+
+            // Set final infotext position
+
+            if (!infoText.empty())
+              setTextPosition(path,
+                              TEXTPOSid,
+                              textPosition,
+                              infoTextRect,
+                              areaWidth,
+                              areaHeight,
+                              textWidth,
+                              textHeight,
+                              tXOffset,
+                              tYOffset);
+
+            // Get symbol positions withing the fill areas
+
+            const char *clrs[] = {"red", "blue", "green", "orange", "brown", "yellow"};
+            size_t symCnt = 0, clrCnt = (sizeof(clrs) / sizeof(char *)), clrIdx = 0;
+
+            if (!areaSymbols || (areas.size() < 2))
+            {
+              for (NFmiFillAreas::const_iterator iter = areas.begin(); (iter != areas.end());
+                   iter++)
               {
-                // fillMode controls whether to get one position for each fill symbol (the default)
-                // or
-                // for each column, or to get all or given percentage of the available positions
-                //
-                std::string fillMode =
-                    configValue<std::string>(scope, surfaceName, "fillmode", s_optional);
-
-                getFillPositions(
-                    areas, width, height, fillSymbols.size(), scale, infoTextRect, fpos, fillMode);
+                getFillPositions(iter, width, height, scale, infoTextRect, fpos, symCnt);
 
                 if (showAreas)
+                {
                   // Draw fill area rects
                   //
-                  for (NFmiFillAreas::const_iterator iter = areas.begin(); (iter != areas.end());
-                       iter++)
-                  {
-                    surfaces << "<rect x=\"" << iter->first.x << "\" y=\"" << iter->first.y
-                             << "\" width=\"" << iter->second.x - iter->first.x << "\" height=\""
-                             << iter->second.y - iter->first.y << "\" fill=\""
-                             << clrs[clrIdx % clrCnt] << "\"/>\n";
-                    clrIdx++;
-                  }
+                  surfaces << "<rect x=\"" << iter->first.x << "\" y=\"" << iter->first.y
+                           << "\" width=\"" << iter->second.x - iter->first.x << "\" height=\""
+                           << iter->second.y - iter->first.y << "\" fill=\""
+                           << clrs[clrIdx % clrCnt] << "\"/>\n";
+                  clrIdx++;
+                }
               }
+            }
+            else if (fillSymbols.size() > 0)
+            {
+              // fillMode controls whether to get one position for each fill symbol (the default)
+              // or
+              // for each column, or to get all or given percentage of the available positions
+              //
+              std::string fillMode =
+                  configValue<std::string>(scope, surfaceName, "fillmode", s_optional);
 
-              // Render the symbols
-              render_symbol(confPath,
-                            pointsymbols,
-                            surfaceName,
-                            "",
-                            0,
-                            0,
-                            nullptr,
-                            false,
-                            nullptr,
-                            &fpos,
-                            (fillSymbols.size() > 0) ? &fillSymbols : nullptr,
-                            width,
-                            height);
+              getFillPositions(
+                  areas, width, height, fillSymbols.size(), scale, infoTextRect, fpos, fillMode);
+
+              if (showAreas)
+                // Draw fill area rects
+                //
+                for (NFmiFillAreas::const_iterator iter = areas.begin(); (iter != areas.end());
+                     iter++)
+                {
+                  surfaces << "<rect x=\"" << iter->first.x << "\" y=\"" << iter->first.y
+                           << "\" width=\"" << iter->second.x - iter->first.x << "\" height=\""
+                           << iter->second.y - iter->first.y << "\" fill=\""
+                           << clrs[clrIdx % clrCnt] << "\"/>\n";
+                  clrIdx++;
+                }
             }
-            else if (!masked)
+
+            // Render the symbols
+            render_symbol(confPath,
+                          pointsymbols,
+                          surfaceName,
+                          "",
+                          0,
+                          0,
+                          nullptr,
+                          false,
+                          nullptr,
+                          &fpos,
+                          (fillSymbols.size() > 0) ? &fillSymbols : nullptr,
+                          width,
+                          height);
+          }
+          else if (!masked)
+          {
+            // glyph
+            std::string _glyph("U");
+            double textlength = static_cast<double>(_glyph.size());
+            double len = path.length();
+            double fontsize = getCssSize(".cloudborderglyph", "font-size");
+            double spacing = 0.0;
+
+            const int CosmologicalConstant = 2;
+            int nglyphs =
+                CosmologicalConstant *
+                static_cast<int>(std::floor(len / (fontsize * textlength + spacing) + 0.5));
+
+            if ((textlength > 0) && (nglyphs > 0))
             {
-              // glyph
-              std::string _glyph("U");
-              double textlength = static_cast<double>(_glyph.size());
-              double len = path.length();
-              double fontsize = getCssSize(".cloudborderglyph", "font-size");
-              double spacing = 0.0;
-
-              const int CosmologicalConstant = 2;
-              int nglyphs =
-                  CosmologicalConstant *
-                  static_cast<int>(std::floor(len / (fontsize * textlength + spacing) + 0.5));
-
-              if ((textlength > 0) && (nglyphs > 0))
-              {
-                std::string glyph(_glyph.size() * nglyphs, ' ');
-                std::string spaces(_glyph.size(), ' ');
-                boost::replace_all(glyph, spaces, _glyph);
-
-                surfaces
-                    << "\"/>\n<text>\n"
-                    << "<textPath class=\"" << style << "\" xlink:href=\"#" << pathId << "\">\n"
-                    << glyph
-                    << "\n</textPath>"
-                    //											 <<
-                    //"<!--
-                    // len="
-                    //<<
-                    // len << " textlength=" << textlength << " fontsize=" << fontsize << " -->"
-                    << "\n</text>\n";
-              }
-              else
-                surfaces << "\"/>\n";
+              std::string glyph(_glyph.size() * nglyphs, ' ');
+              std::string spaces(_glyph.size(), ' ');
+              boost::replace_all(glyph, spaces, _glyph);
+
+              surfaces
+                  << "\"/>\n<text>\n"
+                  << "<textPath class=\"" << style << "\" xlink:href=\"#" << pathId << "\">\n"
+                  << glyph
+                  << "\n</textPath>"
+                  //											 <<
+                  //"<!--
+                  // len="
+                  //<<
+                  // len << " textlength=" << textlength << " fontsize=" << fontsize << " -->"
+                  << "\n</text>\n";
             }
+            else
+              surfaces << "\"/>\n";
           }
-
-          return;
-        }
-        else if (type == "svg")
-        {
-          throw std::runtime_error(confPath + " type 'svg' not implemented yet");
         }
-        else
-          throw std::runtime_error(confPath + ": '" + type + "'" + surfTypeMsg);
+
+        return;
       }
-    }  // for
+      else if (type == "svg")
+      {
+        throw std::runtime_error(confPath + " type 'svg' not implemented yet");
+      }
+      else
+        throw std::runtime_error(confPath + ": '" + type + "'" + surfTypeMsg);
+    }
 
     if (options.debug)
     {
       // No (locale) settings for the surface
       //
-      const char *p = ((surfIdx < 0) ? "Settings for " : "Locale specific settings for ");
+      const char *p =
+          ((surfScope->nameIdx < 0) ? "Settings for " : "Locale specific settings for ");
 
       debugoutput << p << surfaceName << " not found\n";
     }
@@ -2688,123 +2801,179 @@ void SvgRenderer::render_surface(
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Utility function for getting conditional settings based on numerical value.
- * 		Returns the configuration group/block on success or nullptr on not found.
+ * \brief Condition table constructor
  */
 // ----------------------------------------------------------------------
 
-const libconfig::Setting *matchingCondition(const libconfig::Config &config,
-                                            const libconfig::Setting &condSpecs,
-                                            const std::string &confPath,
-                                            const std::string &className,
-                                            int specsIdx,
-                                            const std::string &parameter,
-                                            const double numericValue)
+ConditionTable::ConditionTable(const libconfig::Setting &theCondSpecs,
+                               const std::string &theConfPath,
+                               const std::string &theClassName)
+    : itsCondSpecs(theCondSpecs),
+      itsConfPath(theConfPath),
+      itsClassName(theClassName),
+      hasNumeric(false),
+      itsEqNanIdx(-1),
+      hasTimeRanges(false),
+      hasStrings(false)
 {
   const char *typeMsg = " must contain a list of groups in parenthesis";
+
+  if (!itsCondSpecs.isList())
+    throw std::runtime_error(itsConfPath + ".conditions" + typeMsg);
+
+  for (int i = 0; i < itsCondSpecs.getLength(); i++)
+    if (!itsCondSpecs[i].isGroup())
+      throw std::runtime_error(itsConfPath + ".conditions" + typeMsg);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Compile numeric conditions.
+ *
+ *		The comparison values are stored into value sorted tables by the
+ *		comparison type; eq, le and lt tables are sorted by value and index and
+ *		ge and gt tables by value and descending index, so that the nearest
+ *		bound for a value is found by binary search and the first condition
+ *		is used if there are multiple conditions with equal value.
+ */
+// ----------------------------------------------------------------------
+
+void ConditionTable::compileNumeric()
+{
   const char *condMsg = ": refix must be 'eq', 'le', 'lt', 'ge' or 'gt'";
   const char *valMsg = ": value must be numeric or 'NaN'";
 
-  double ltCondValue = 0.0, gtCondValue = 0.0, eps = 0.00001;
-  int ltCondIdx = -1, gtCondIdx = -1, idx = -1;
-
-  for (int i = 0; i < condSpecs.getLength(); i++)
+  for (int i = 0; i < itsCondSpecs.getLength(); i++)
   {
-    const libconfig::Setting &conds = condSpecs[i];
-    if (!conds.isGroup())
-      throw std::runtime_error(confPath + ".conditions" + typeMsg);
+    const libconfig::Setting &conds = itsCondSpecs[i];
 
-    std::string refix(configValue<std::string>(conds, className, "refix"));
-    double condValue = 0.0;
-    bool eqNan = false;
+    std::string refix(configValue<std::string>(conds, itsClassName, "refix"));
 
-    // Check for equal to NaN condition.
+    if ((refix != "eq") && (refix != "le") && (refix != "lt") && (refix != "ge") &&
+        (refix != "gt"))
+      throw std::runtime_error(itsConfPath + ".conditions: '" + refix + "'" + condMsg);
 
-    try
-    {
-      try
-      {
-        if (boost::algorithm::to_lower_copy(lookup<std::string>(conds, confPath, "value")) != "nan")
-          throw std::runtime_error(confPath + ".conditions" + valMsg);
+    // Check for equal to NaN condition. Only eq match for NaN.
 
-        if (!std::isnan(numericValue))
-          continue;
-
-        eqNan = true;
-      }
-      catch (libconfig::SettingTypeException &ex)
-      {
-        // Value is (should be) then numeric
+    std::optional<std::string> nanValue = lookup_optional<std::string>(conds, "value");
 
-        condValue = configValue<double>(conds, className, "value");
-      }
-      catch (...)
-      {
-        throw;
-      }
-    }
-    catch (...)
+    if (nanValue)
     {
-      throw;
+      if (boost::algorithm::to_lower_copy(*nanValue) != "nan")
+        throw std::runtime_error(itsConfPath + ".conditions" + valMsg);
+
+      if ((refix == "eq") && (itsEqNanIdx < 0))
+        itsEqNanIdx = i;
+
+      continue;
     }
 
+    // Value is (should be) then numeric
+
+    Bound bound;
+    bound.value = configValue<double>(conds, itsClassName, "value");
+    bound.idx = i;
+
     if (refix == "eq")
-    {
-      if (eqNan || (fabs(condValue - numericValue) <= eps))
-      {
-        ltCondIdx = gtCondIdx = i;
-        break;
-      }
-    }
-    else if (eqNan)
-      // Only eq match for NaN.
-      ;
+      itsEq.push_back(bound);
     else if (refix == "le")
-    {
-      if (((condValue >= numericValue) || (fabs(condValue - numericValue) <= eps)) &&
-          ((ltCondIdx < 0) || (condValue < ltCondValue)))
-      {
-        ltCondValue = condValue;
-        ltCondIdx = i;
-      }
-    }
+      itsLe.push_back(bound);
     else if (refix == "lt")
-    {
-      if ((condValue > numericValue) && ((ltCondIdx < 0) || (condValue < ltCondValue)))
-      {
-        ltCondValue = condValue;
-        ltCondIdx = i;
-      }
-    }
+      itsLt.push_back(bound);
     else if (refix == "ge")
-    {
-      if (((condValue <= numericValue) || (fabs(condValue - numericValue) <= eps)) &&
-          ((gtCondIdx < 0) || (condValue > gtCondValue)))
-      {
-        gtCondValue = condValue;
-        gtCondIdx = i;
-      }
-    }
-    else if (refix == "gt")
-    {
-      if ((condValue < numericValue) && ((gtCondIdx < 0) || (condValue > gtCondValue)))
-      {
-        gtCondValue = condValue;
-        gtCondIdx = i;
-      }
-    }
+      itsGe.push_back(bound);
     else
-      throw std::runtime_error(confPath + ".conditions: '" + refix + "'" + condMsg);
+      itsGt.push_back(bound);
   }
 
-  if ((ltCondIdx >= 0) || (gtCondIdx >= 0))
+  auto ascending = [](const Bound &b1, const Bound &b2)
+  { return ((b1.value < b2.value) || ((b1.value == b2.value) && (b1.idx < b2.idx))); };
+  auto descendingIdx = [](const Bound &b1, const Bound &b2)
+  { return ((b1.value < b2.value) || ((b1.value == b2.value) && (b1.idx > b2.idx))); };
+
+  std::sort(itsEq.begin(), itsEq.end(), ascending);
+  std::sort(itsLe.begin(), itsLe.end(), ascending);
+  std::sort(itsLt.begin(), itsLt.end(), ascending);
+  std::sort(itsGe.begin(), itsGe.end(), descendingIdx);
+  std::sort(itsGt.begin(), itsGt.end(), descendingIdx);
+
+  hasNumeric = true;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get conditional settings based on numerical value.
+ * 		Returns the configuration group/block on success or nullptr on not found.
+ *
+ *		Equal to match is used if available; otherwise the nearest le/lt
+ *		or ge/gt bound is used.
+ */
+// ----------------------------------------------------------------------
+
+const libconfig::Setting *ConditionTable::match(double theValue, const std::string &)
+{
+  if (!hasNumeric)
+    compileNumeric();
+
+  if (std::isnan(theValue))
+    return ((itsEqNanIdx >= 0) ? &(itsCondSpecs[itsEqNanIdx]) : nullptr);
+
+  const double eps = 0.00001;
+
+  auto within = [&](const Bound &b) { return (fabs(b.value - theValue) <= eps); };
+
+  // Equal to; the first condition within the tolerance is used
+
+  int eqIdx = -1;
+
+  for (auto it = std::partition_point(itsEq.begin(),
+                                      itsEq.end(),
+                                      [&](const Bound &b)
+                                      { return ((b.value < theValue) && (!within(b))); });
+       ((it != itsEq.end()) && within(*it));
+       it++)
+    if ((eqIdx < 0) || (it->idx < eqIdx))
+      eqIdx = it->idx;
+
+  if (eqIdx >= 0)
+    return &(itsCondSpecs[eqIdx]);
+
+  // Nearest upper bound (smallest le/lt value) and nearest lower bound (greatest ge/gt value)
+
+  auto le = std::partition_point(itsLe.begin(),
+                                 itsLe.end(),
+                                 [&](const Bound &b)
+                                 { return ((b.value < theValue) && (!within(b))); });
+  auto lt = std::partition_point(
+      itsLt.begin(), itsLt.end(), [&](const Bound &b) { return (b.value <= theValue); });
+  auto ge = std::partition_point(itsGe.begin(),
+                                 itsGe.end(),
+                                 [&](const Bound &b)
+                                 { return ((b.value <= theValue) || within(b)); });
+  auto gt = std::partition_point(
+      itsGt.begin(), itsGt.end(), [&](const Bound &b) { return (b.value < theValue); });
+
+  const Bound *ltBound = ((le != itsLe.end()) ? &(*le) : nullptr);
+  const Bound *gtBound = ((ge != itsGe.begin()) ? &(*(ge - 1)) : nullptr);
+
+  if ((lt != itsLt.end()) &&
+      ((!ltBound) || (lt->value < ltBound->value) ||
+       ((lt->value == ltBound->value) && (lt->idx < ltBound->idx))))
+    ltBound = &(*lt);
+
+  if ((gt != itsGt.begin()) &&
+      ((!gtBound) || ((gt - 1)->value > gtBound->value) ||
+       (((gt - 1)->value == gtBound->value) && ((gt - 1)->idx < gtBound->idx))))
+    gtBound = &(*(gt - 1));
+
+  if (ltBound || gtBound)
   {
-    idx = ((ltCondIdx < 0) ||
-           ((gtCondIdx >= 0) && ((numericValue - ltCondValue) > (gtCondValue - numericValue))))
-              ? gtCondIdx
-              : ltCondIdx;
+    const Bound *bound =
+        ((!ltBound) || (gtBound && ((theValue - ltBound->value) > (gtBound->value - theValue))))
+            ? gtBound
+            : ltBound;
 
-    return &(condSpecs[idx]);
+    return &(itsCondSpecs[bound->idx]);
   }
 
   return nullptr;
@@ -2812,171 +2981,200 @@ const libconfig::Setting *matchingCondition(const libconfig::Config &config,
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Utility function for getting conditional settings based on datetime value.
- * 		Returns the configuration group/block on success or nullptr on not found.
+ * \brief Compile hh[:mm]-hh[:mm] time range conditions.
+ *
+ *		The day is split into segments at the range limits; each segment
+ *		stores the indexes of the conditions whose range covers the segment.
  */
 // ----------------------------------------------------------------------
 
-const libconfig::Setting *matchingCondition(const libconfig::Config &config,
-                                            const libconfig::Setting &condSpecs,
-                                            const std::string &confPath,
-                                            const std::string &className,
-                                            int specsIdx,
-                                            const std::string &parameter,
-                                            const Fmi::DateTime &dateTimeValue)
+void ConditionTable::compileTimeRanges()
 {
-  const char *typeMsg = " must contain a list of groups in parenthesis";
   const char *condMsg = ": refix must be 'range'";
   const char *rngMsg = ": hh[:mm]-hh[:mm] range expected";
+  const int daySecs = 24 * 3600;
 
-  for (int i = 0; i < condSpecs.getLength(); i++)
+  // Ranges (seconds of day) as closed intervals; a range over midnight is split into two
+
+  std::vector<std::pair<int, std::pair<int, int> > > ranges;
+
+  for (int i = 0; i < itsCondSpecs.getLength(); i++)
   {
-    const libconfig::Setting &conds = condSpecs[i];
-    if (!conds.isGroup())
-      throw std::runtime_error(confPath + ".conditions" + typeMsg);
+    const libconfig::Setting &conds = itsCondSpecs[i];
 
-    std::string refix(configValue<std::string>(conds, className, "refix", nullptr, s_optional));
-    std::string condValue(configValue<std::string>(conds, className, "value"));
+    std::string refix(configValue<std::string>(conds, itsClassName, "refix", nullptr, s_optional));
+    std::string condValue(configValue<std::string>(conds, itsClassName, "value"));
     std::string rngErr;
 
     // Currently only hh[:mm]-hh[:mm] range comparison supported
     //
-    if ((refix == "") || (refix == "range"))
+    if ((refix != "") && (refix != "range"))
+      throw std::runtime_error(itsConfPath + ".conditions: '" + refix + "'" + condMsg);
+
+    // Get hh[:mm]-hh[:mm] time range
+    //
+    std::vector<std::string> defs;
+    boost::split(defs, condValue, boost::is_any_of("-"));
+
+    bool ok = false;
+
+    if (defs.size() == 2)
     {
-      // Get hh[:mm]-hh[:mm] time range
-      //
-      std::vector<std::string> defs;
-      boost::split(defs, condValue, boost::is_any_of("-"));
+      std::vector<std::string> loRng;
+      boost::trim(defs[0]);
+      boost::split(loRng, defs[0], boost::is_any_of(":"));
 
-      if (defs.size() == 2)
-      {
-        std::vector<std::string> loRng;
-        boost::trim(defs[0]);
-        boost::split(loRng, defs[0], boost::is_any_of(":"));
+      std::vector<std::string> hiRng;
+      boost::trim(defs[1]);
+      boost::split(hiRng, defs[1], boost::is_any_of(":"));
 
-        std::vector<std::string> hiRng;
-        boost::trim(defs[1]);
-        boost::split(hiRng, defs[1], boost::is_any_of(":"));
+      int lh, lm, hh, hm;
 
-        int lh, lm, hh, hm;
+      if ((loRng.size() <= 2) || (hiRng.size() <= 2))
+        try
+        {
+          lh = boost::lexical_cast<unsigned int>(loRng[0]);
+          lm = ((loRng.size() == 2) ? boost::lexical_cast<unsigned int>(loRng[1]) : 0);
+          hh = boost::lexical_cast<unsigned int>(hiRng[0]);
+          hm = ((hiRng.size() == 2) ? boost::lexical_cast<unsigned int>(hiRng[1]) : 0);
 
-        if ((loRng.size() <= 2) || (hiRng.size() <= 2))
-          try
+          if ((lh <= 23) && (lm <= 59) && (hh <= 23) && (hm <= 59))
           {
-            lh = boost::lexical_cast<unsigned int>(loRng[0]);
-            lm = ((loRng.size() == 2) ? boost::lexical_cast<unsigned int>(loRng[1]) : 0);
-            hh = boost::lexical_cast<unsigned int>(hiRng[0]);
-            hm = ((hiRng.size() == 2) ? boost::lexical_cast<unsigned int>(hiRng[1]) : 0);
+            int lo = (lh * 3600) + (lm * 60), hi = (hh * 3600) + (hm * 60);
+
+            // Range is over midnight if hi range is less than or equal to lo range (eg. 18-06)
 
-            if ((lh <= 23) && (lm <= 59) && (hh <= 23) && (hm <= 59))
+            if (hi > lo)
+              ranges.push_back(std::make_pair(i, std::make_pair(lo, hi)));
+            else
             {
-              // Build lo and hi range timestamps using validtime's date and given time range
-              //
-              Fmi::DateTime ldt(
-                  dateTimeValue.date(),
-                  Fmi::Hours(lh) + Fmi::Minutes(lm));
-              Fmi::DateTime hdt(
-                  dateTimeValue.date(),
-                  Fmi::Hours(hh) + Fmi::Minutes(hm));
+              ranges.push_back(std::make_pair(i, std::make_pair(lo, daySecs - 1)));
+              ranges.push_back(std::make_pair(i, std::make_pair(0, hi)));
+            }
 
-              // Advance hi range to next day if less than or equal to lo range (eg. range 18-06)
+            ok = true;
+          }
+        }
+        catch (std::exception &ex)
+        {
+          rngErr = std::string(": ") + ex.what();
+        }
+    }
 
-              if (hdt <= ldt)
-                hdt += Fmi::Days(1);
+    if (!ok)
+      throw std::runtime_error(itsConfPath + ".conditions: '" + condValue + "'" + rngMsg +
+                               rngErr);
+  }
 
-              // Advance validtime to next day if less than lo range
+  // Split the day into segments at range starts and ends
 
-              Fmi::DateTime vdt(dateTimeValue);
-              if (vdt < ldt)
-                vdt += Fmi::Days(1);
+  std::set<int> cuts;
+  cuts.insert(0);
 
-              if ((vdt >= ldt) && (vdt <= hdt))
-              {
-                // Validtime is between the range; check if the parameter is available
-                //
-                std::string condPath(
-                    confPath +
-                    ((specsIdx >= 0) ? (".[" + Fmi::to_string(specsIdx) + "]")
-                                     : "") +
-                    ".conditions" + ".[" + Fmi::to_string(i) + "]." + parameter);
-
-                if (parameter.empty() || config.exists(condPath))
-                  return &(condSpecs[i]);
-              }
+  for (auto const &range : ranges)
+  {
+    cuts.insert(range.second.first);
+    cuts.insert(range.second.second + 1);
+  }
 
-              continue;
-            }
-          }
-          catch (std::exception &ex)
-          {
-            rngErr = std::string(": ") + ex.what();
-          }
-      }
+  itsSegments.clear();
+  itsSegmentConds.clear();
 
-      throw std::runtime_error(confPath + ".conditions: '" + condValue + "'" + rngMsg + rngErr);
-    }
-    else
-      throw std::runtime_error(confPath + ".conditions: '" + refix + "'" + condMsg);
+  for (auto cut : cuts)
+  {
+    if (cut >= daySecs)
+      break;
+
+    std::vector<int> segmentConds;
+
+    for (auto const &range : ranges)
+      if ((cut >= range.second.first) && (cut <= range.second.second))
+        segmentConds.push_back(range.first);
+
+    std::sort(segmentConds.begin(), segmentConds.end());
+    segmentConds.erase(std::unique(segmentConds.begin(), segmentConds.end()), segmentConds.end());
+
+    itsSegments.push_back(cut);
+    itsSegmentConds.push_back(segmentConds);
   }
 
-  return nullptr;
+  hasTimeRanges = true;
 }
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Utility function for getting conditional settings based on string value.
+ * \brief Get conditional settings based on datetime value.
  * 		Returns the configuration group/block on success or nullptr on not found.
+ *
+ *		The first condition whose time range covers the value's time of day
+ *		and which has the given parameter (if any) is used.
  */
 // ----------------------------------------------------------------------
 
-const libconfig::Setting *matchingCondition(const libconfig::Config &config,
-                                            const libconfig::Setting &condSpecs,
-                                            const std::string &confPath,
-                                            const std::string &className,
-                                            int specsIdx,
-                                            const std::string &parameter,
-                                            const std::string &stringValue)
+const libconfig::Setting *ConditionTable::match(const Fmi::DateTime &theValue,
+                                                const std::string &theParameter)
 {
-  const char *typeMsg = " must contain a list of groups in parenthesis";
-  const char *condMsg = ": refix must be 'eq'";
-  const char *valMsg = ": string value expected";
+  if (!hasTimeRanges)
+    compileTimeRanges();
+
+  if (itsSegments.empty())
+    return nullptr;
 
-  std::string s(boost::algorithm::to_lower_copy(stringValue));
+  int secs = (theValue.time_of_day().hours() * 3600) + (theValue.time_of_day().minutes() * 60) +
+             theValue.time_of_day().seconds();
+
+  size_t segment = (std::upper_bound(itsSegments.begin(), itsSegments.end(), secs) -
+                    itsSegments.begin()) -
+                   1;
+
+  for (auto idx : itsSegmentConds[segment])
+    if (theParameter.empty() || itsCondSpecs[idx].exists(theParameter))
+      return &(itsCondSpecs[idx]);
+
+  return nullptr;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Compile string conditions
+ */
+// ----------------------------------------------------------------------
 
-  int i;
+void ConditionTable::compileStrings()
+{
+  const char *valMsg = ": string value expected";
 
-  for (i = 0; i < condSpecs.getLength(); i++)
+  for (int i = 0; i < itsCondSpecs.getLength(); i++)
   {
-    const libconfig::Setting &conds = condSpecs[i];
-    if (!conds.isGroup())
-      throw std::runtime_error(confPath + ".conditions" + typeMsg);
+    std::optional<std::string> condValue = lookup_optional<std::string>(itsCondSpecs[i], "value");
 
-    std::string refix("eq" /*configValue<std::string>(conds,className,"refix")*/), condValue;
+    if (!condValue)
+      throw std::runtime_error(itsConfPath + ".conditions" + valMsg);
 
-    if (refix == "eq")
-    {
-      try
-      {
-        condValue = boost::algorithm::to_lower_copy(lookup<std::string>(conds, confPath, "value"));
-      }
-      catch (...)
-      {
-        throw std::runtime_error(confPath + ".conditions" + valMsg);
-      }
+    // The first matching condition is used
 
-      if (condValue == s)
-      {
-        break;
-      }
-    }
-    else
-      throw std::runtime_error(confPath + ".conditions: '" + refix + "'" + condMsg);
+    itsStrings.insert(std::make_pair(boost::algorithm::to_lower_copy(*condValue), i));
   }
 
-  if (i < condSpecs.getLength())
-    return &(condSpecs[i]);
+  hasStrings = true;
+}
 
-  return nullptr;
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get conditional settings based on string value.
+ * 		Returns the configuration group/block on success or nullptr on not found.
+ */
+// ----------------------------------------------------------------------
+
+const libconfig::Setting *ConditionTable::match(const std::string &theValue,
+                                                const std::string &)
+{
+  if (!hasStrings)
+    compileStrings();
+
+  auto iter = itsStrings.find(boost::algorithm::to_lower_copy(theValue));
+
+  return ((iter != itsStrings.end()) ? &(itsCondSpecs[iter->second]) : nullptr);
 }
 
 // ----------------------------------------------------------------------
@@ -2986,28 +3184,16 @@ const libconfig::Setting *matchingCondition(const libconfig::Config &config,
 // ----------------------------------------------------------------------
 
 template <typename T>
-const libconfig::Setting *matchingCondition(const libconfig::Config &config,
+const libconfig::Setting *matchingCondition(ConfigResolver &configResolver,
                                             const std::string &confPath,
                                             const std::string &className,
                                             const std::string &parameter,
                                             int specsIdx,
                                             const T &condValue)
 {
-  const char *typeMsg = " must contain a list of groups in parenthesis";
-
-  std::string condPath(
-      confPath +
-      ((specsIdx >= 0) ? (".[" + Fmi::to_string(specsIdx) + "]") : "") +
-      ".conditions");
-
-  if (!config.exists(condPath))
-    return nullptr;
+  ConditionTable *conditions = configResolver.conditions(confPath, className, specsIdx);
 
-  const libconfig::Setting &condSpecs = config.lookup(condPath);
-  if (!condSpecs.isList())
-    throw std::runtime_error(confPath + ".conditions" + typeMsg);
-
-  return matchingCondition(config, condSpecs, confPath, className, specsIdx, parameter, condValue);
+  return (conditions ? conditions->match(condValue, parameter) : nullptr);
 }
 
 // ----------------------------------------------------------------------
@@ -3072,7 +3258,7 @@ std::string formattedValue(const woml::NumericalSingleValueMeasure *lowerLimit,
                            const std::string &pref,
                            double *scale = nullptr,
                            const libconfig::Setting *specs = nullptr,
-                           libconfig::Setting *globalScope = nullptr)
+                           const libconfig::Setting *globalScope = nullptr)
 {
   if (pref.empty())
     return upperLimit ? (lowerLimit->value() + ".." + upperLimit->value())
@@ -3429,7 +3615,7 @@ void SvgRenderer::render_aerodromeSymbols(const T &theFeature,
 
         if (cvm)
         {
-          condSpecs = matchingCondition(config, confPath, confPath, "", -1, cvm->value());
+          condSpecs = matchingCondition(configResolver, confPath, confPath, "", -1, cvm->value());
 
           if (condSpecs)
           {
@@ -3508,80 +3694,340 @@ void SvgRenderer::render_aerodromeSymbols(const T &theFeature,
         }
       }
 
-      // Render the symbol or visibility value
+      // Render the symbol or visibility value
+
+      if (cvm)
+        // Symbol
+        //
+        render_aerodromeSymbol(confPath, symClass, theFeature.classNameExt(), cvm->value(), x, y);
+      else
+      {
+        // Format visibility based on it's value
+        //
+        // The default format is "%.1f KM" upto visibilityPrec100m and "%.0f KM" above it
+        //
+        double scale = 1000.0, value = nsv->numericValue();
+        std::string pref;
+
+        const libconfig::Setting *condSpecs =
+            matchingCondition(configResolver, confPath, confPath, "", -1, value);
+
+        if (condSpecs)
+          pref = configValue<std::string>(*condSpecs, confPath, "pref", &specs);
+        else
+          pref = configValue<std::string>(specs, confPath, "pref", nullptr, s_optional);
+
+        if (pref.empty())
+        {
+          const double visibilityPrec100m = 5000.0;
+          pref = ((value <= visibilityPrec100m) ? "%.1f KM" : "%.0f KM");
+        }
+
+        render_aerodromeSymbol(confPath,
+                               symClass,
+                               theFeature.classNameExt(),
+                               formattedValue(nsv, nullptr, confPath, pref, &scale),
+                               x,
+                               y,
+                               false);
+      }
+    }
+
+    // Visibility information for "nonground" data (MigratoryBirds)
+
+    if (!ground)
+    {
+      if (!visible)
+      {
+        if (!aboveTop)
+        {
+          // Show the fixed template text "No xxx"
+          //
+          const std::string NOFEATURE(FEATURE + "NO" + FEATURE);
+          texts[NOFEATURE] << classDef << "Visible";
+        }
+        else
+        {
+          // Show the fixed template text "xxx are located in the upper"
+          //
+          const std::string FEATUREUPPER(FEATURE + "INTHEUPPER");
+          texts[FEATUREUPPER] << classDef << "Visible";
+        }
+      }
+
+      // Show the xxx legend (even if no xxx exists or are visible)
+
+      const std::string FEATUREVISIBLE(FEATURE + "VISIBLE");
+      texts[FEATUREVISIBLE] << classDef << "Visible";
+    }
+  }
+  catch (libconfig::ConfigException &ex)
+  {
+    if (!config.exists(confPath))
+      throw std::runtime_error("Settings for " + confPath + " are missing");
+
+    throw ex;
+  }
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Resolve conseptual model symbol's settings.
+ *
+ *		The settings are resolved once for each symbol class, code and
+ *		matching conditions (and for the flags affecting which settings are
+ *		required); the rest of the symbols of the class are cache hits.
+ *
+ *		Returns nullptr if there are no settings for confPath.
+ */
+// ----------------------------------------------------------------------
+
+const SymbolSpec *SvgRenderer::symbolSpec(const std::string &confPath,
+                                          const std::string &symClass,
+                                          const std::string &symCode,
+                                          const woml::NumericalSingleValueMeasure *svm,
+                                          bool fill,
+                                          bool areaSymbols,
+                                          bool hasSize)
+{
+  const char *symTypeMsg = ": symbol type must be 'svg', 'img' or 'font'";
+
+  const ConfigBlocks *symbolBlocks = configResolver.blocks(confPath);
+
+  if (!symbolBlocks)
+    return nullptr;
+
+  std::string _symCode("code" + (symCode.empty() ? "" : ("_" + symCode)));
+
+  // Search for conditional settings based on the documents validTime (it's time value) or
+  // given measurement value. The matching conditions are part of the cache key.
+
+  std::vector<const libconfig::Setting *> condSpecs(symbolBlocks->size(), nullptr);
+  std::ostringstream key;
+
+  key << confPath << "\n"
+      << symClass << "\n"
+      << symCode << "\n"
+      << (svm ? 1 : 0) << (fill ? 1 : 0) << (areaSymbols ? 1 : 0) << (hasSize ? 1 : 0);
+
+  for (size_t i = 0; i < symbolBlocks->size(); ++i)
+  {
+    const ConfigBlock &block = (*symbolBlocks)[i];
+
+    if (block.hasName && (block.name == symClass) &&
+        ((block.locale == options.locale) || (block.locale == "")))
+    {
+      condSpecs[i] =
+          svm ? matchingCondition(configResolver, confPath, symClass, "", i, svm->numericValue())
+              : matchingCondition(configResolver, confPath, symClass, _symCode, i, validtime);
+
+      key << "\n" << condSpecs[i];
+    }
+  }
+
+  auto iter = symbolSpecs.find(key.str());
+
+  if (iter != symbolSpecs.end())
+    return &(iter->second);
+
+  SymbolSpec spec;
+
+  spec.found = false;
+  spec.symbolIdx = spec.localeIdx = -1;
+  spec.hasLocaleGlobals = false;
+
+  settings s_code((settings)(s_base + 1));
+
+  // Configuration blocks to search values for the settings; global blocks (blocks with no name),
+  // locale global blocks (blocks with matching name but having no locale) and the current block
+  // (block with matching name and locale).
+  //
+  // The blocks are stored to the list in the order of appearance (and having current block
+  // as the last element). The list is processed in reverse order when searching.
+  //
+  // Current block or locale global block is needed for rendering.
+  //
+  std::list<const libconfig::Setting *> &scope = spec.scope;
+  bool nameMatch;
+  bool _hasLocaleGlobals = false;
+
+  int lastIdx = symbolBlocks->size() - 1;
+
+  for (int i = 0; i <= lastIdx; ++i)
+  {
+    const ConfigBlock &block = (*symbolBlocks)[i];
+    const libconfig::Setting &specs = *(block.specs);
+
+    if (!block.hasName)
+      // Global settings have no name
+      //
+      scope.push_back(&specs);
+
+    nameMatch = (block.hasName && (block.name == symClass));
+
+    // Enter the block on matching name and for last config entry to load/use the globals
+    //
+    if (nameMatch || ((i == lastIdx) && _hasLocaleGlobals))
+    {
+      if (nameMatch)
+      {
+        spec.symbolIdx = i;
+
+        // Locale
+        //
+        const std::string &locale = block.locale;
+        bool localeMatch = (locale == options.locale);
+
+        if (localeMatch || (locale == ""))
+        {
+          scope.push_back(&specs);
+
+          if (localeMatch)
+            spec.localeIdx = i;
+          else
+            spec.hasLocaleGlobals = _hasLocaleGlobals = true;
+
+          if (condSpecs[i])
+            scope.push_back(condSpecs[i]);
+        }
+
+        // Continue searching unless got (new) current block or reached the end of configuration
+        // and there is (new) locale global blocks to use
+
+        if ((!localeMatch) && ((i < lastIdx) || (!_hasLocaleGlobals)))
+          continue;
+      }
+
+      // Symbol code. May contain folder too; [<folder>/]<code>
+
+      if (!areaSymbols)
+      {
+        try
+        {
+          // Note: When rendering wind symbol with wind speed, using primarily 'code' key for
+          //		 symbol mapping (used conditionally to map all wind symbols to 'calm' if
+          // speed
+          // is
+          // nan)
+          //
+          spec.code = getFolderAndSymbol(config,
+                                         &scope,
+                                         confPath,
+                                         symClass,
+                                         _symCode,
+                                         s_code,
+                                         validtime,
+                                         spec.folder,
+                                         svm ? true : false);
+        }
+        catch (SettingIdNotFoundException &ex)
+        {
+          // Symbol code not found
+          //
+          // Clear _hasLocaleGlobals to indicate the settings have been scanned upto current block
+          // and
+          // there's no use to enter here again unless new locale global block(s) or current block
+          // is met
+          //
+          _hasLocaleGlobals = false;
+          continue;
+        }
+      }
+
+      // Symbol type; (fill, fill+mask ==>) svg, img or font
+      spec.type = configValue<std::string>(scope, symClass, "type");
 
-      if (cvm)
-        // Symbol
-        //
-        render_aerodromeSymbol(confPath, symClass, theFeature.classNameExt(), cvm->value(), x, y);
+      // x- and y- position offsets (mainly to center font symbol glyphs)
+      //
+      spec.xoffset = spec.yoffset = 0;
+
+      if ((spec.type == "fill") || (spec.type == "fill+mask"))
+        spec.type = "svg";
       else
       {
-        // Format visibility based on it's value
-        //
-        // The default format is "%.1f KM" upto visibilityPrec100m and "%.0f KM" above it
-        //
-        double scale = 1000.0, value = nsv->numericValue();
-        std::string pref;
+        bool isSet;
+
+        spec.xoffset = static_cast<int>(
+            floor(configValue<float, int>(scope, symClass, "xoffset", s_optional, &isSet)));
+        if (!isSet)
+          spec.xoffset = 0;
+        spec.yoffset = static_cast<int>(
+            floor(configValue<float, int>(scope, symClass, "yoffset", s_optional, &isSet)));
+        if (!isSet)
+          spec.yoffset = 0;
+      }
 
-        const libconfig::Setting *condSpecs =
-            matchingCondition(config, confPath, confPath, "", -1, value);
+      // Output placeholder; by default output to passed stream. The setting is ignored for
+      // ParameterValueSetArea.
 
-        if (condSpecs)
-          pref = configValue<std::string>(*condSpecs, confPath, "pref", &specs);
-        else
-          pref = configValue<std::string>(specs, confPath, "pref", nullptr, s_optional);
+      spec.placeHolder = (areaSymbols ? ""
+                                      : boost::algorithm::trim_copy(configValue<std::string>(
+                                            scope, symClass, "output", s_optional)));
 
-        if (pref.empty())
-        {
-          const double visibilityPrec100m = 5000.0;
-          pref = ((value <= visibilityPrec100m) ? "%.1f KM" : "%.0f KM");
-        }
+      spec.hasScale = spec.hasWidth = spec.hasHeight = false;
+      spec.scale = 0.0;
+      spec.width = spec.height = 0;
 
-        render_aerodromeSymbol(confPath,
-                               symClass,
-                               theFeature.classNameExt(),
-                               formattedValue(nsv, nullptr, confPath, pref, &scale),
-                               x,
-                               y,
-                               false);
-      }
-    }
+      if ((spec.type == "svg") || (spec.type == "img"))
+      {
+        // Some settings are required for svg but optional for img
+        //
+        settings reqORopt = ((spec.type == "svg") ? s_required : s_optional);
 
-    // Visibility information for "nonground" data (MigratoryBirds)
+        // If symbol url is not given, 'use' reference is generated
 
-    if (!ground)
-    {
-      if (!visible)
-      {
-        if (!aboveTop)
+        spec.uri = configValue<std::string>(scope, symClass, "url", fill ? s_required : s_optional);
+
+        if (spec.uri.empty())
         {
-          // Show the fixed template text "No xxx"
-          //
-          const std::string NOFEATURE(FEATURE + "NO" + FEATURE);
-          texts[NOFEATURE] << classDef << "Visible";
+          spec.classDef = configValue<std::string>(scope, symClass, "class", s_optional);
+          if (spec.classDef.empty())
+            spec.classDef = spec.code;
+
+          spec.scale = configValue<double>(scope, symClass, "scale", s_optional, &spec.hasScale);
         }
         else
         {
-          // Show the fixed template text "xxx are located in the upper"
-          //
-          const std::string FEATUREUPPER(FEATURE + "INTHEUPPER");
-          texts[FEATUREUPPER] << classDef << "Visible";
+          if (spec.folder.empty())
+            spec.folder = configValue<std::string, int>(scope, symClass, "folder", reqORopt);
+
+          if (!hasSize)
+          {
+            spec.width = configValue<int>(scope, symClass, "width", reqORopt, &spec.hasWidth);
+            spec.height = configValue<int>(scope, symClass, "height", reqORopt, &spec.hasHeight);
+          }
+          else
+            spec.hasWidth = spec.hasHeight = true;
+
+          if (!areaSymbols)
+          {
+            boost::algorithm::replace_all(spec.uri, "%folder%", spec.folder);
+            boost::algorithm::replace_all(spec.uri, "%symbol%", spec.code + "." + spec.type);
+          }
         }
       }
+      else if (spec.type == "font")
+      {
+        // Use last of the given classes for symbol specific class reference
+        //
+        spec.class1 = configValue<std::string>(scope, symClass, "class");
+        boost::trim(spec.class1);
 
-      // Show the xxx legend (even if no xxx exists or are visible)
+        std::vector<std::string> classes;
+        boost::split(classes, spec.class1, boost::is_any_of(" "));
 
-      const std::string FEATUREVISIBLE(FEATURE + "VISIBLE");
-      texts[FEATUREVISIBLE] << classDef << "Visible";
-    }
-  }
-  catch (libconfig::ConfigException &ex)
-  {
-    if (!config.exists(confPath))
-      throw std::runtime_error("Settings for " + confPath + " are missing");
+        spec.class2 = ((spec.class1.empty() ? "" : " ") + classes[classes.size() - 1] +
+                       (symCode.empty() ? symClass : symCode));
+      }
+      else
+        throw std::runtime_error(confPath + ": '" + spec.type + "'" + symTypeMsg);
 
-    throw ex;
-  }
+      spec.found = true;
+      break;
+    }  // if
+  }    // for
+
+  return &(symbolSpecs[key.str()] = spec);
 }
 
 // ----------------------------------------------------------------------
@@ -3629,419 +4075,259 @@ void SvgRenderer::render_symbol(const std::string &confPath,
 
   try
   {
-    const char *typeMsg = " must contain a list of groups in parenthesis";
-    const char *symTypeMsg = ": symbol type must be 'svg', 'img' or 'font'";
-
-    const libconfig::Setting &symbolSpecs = config.lookup(confPath);
-    if (!symbolSpecs.isList())
-      throw std::runtime_error(confPath + typeMsg);
+    const SymbolSpec *spec = symbolSpec(confPath,
+                                        symClass,
+                                        symCode,
+                                        svm,
+                                        fpos ? true : false,
+                                        areaSymbols ? true : false,
+                                        ((width > 0) && (height > 0)));
 
-    settings s_name((settings)(s_base + 0));
-    settings s_code((settings)(s_base + 1));
-
-    // Configuration blocks to search values for the settings; global blocks (blocks with no name),
-    // locale global blocks (blocks with matching name but having no locale) and the current block
-    // (block with matching name and locale).
-    //
-    // The blocks are stored to the list in the order of appearance (and having current block
-    // as the last element). The list is processed in reverse order when searching.
-    //
-    // Current block or locale global block is needed for rendering.
-    //
-    std::list<const libconfig::Setting *> scope;
-    bool nameMatch;
-    bool hasLocaleGlobals = false, _hasLocaleGlobals = false;
+    if (!spec)
+    {
+      // No settings for confPath
+      //
+      if (options.debug)
+        debugoutput << "Settings for " << confPath << " (" << symClass << ") not found\n";
 
-    int symbolIdx = -1, localeIdx = -1;
-    int lastIdx = symbolSpecs.getLength() - 1;
+      return;
+    }
 
-    for (int i = 0; i <= lastIdx; ++i)
+    if (!spec->found)
     {
-      const libconfig::Setting &specs = symbolSpecs[i];
-      if (!specs.isGroup())
-        throw std::runtime_error(confPath + typeMsg);
-
-      try
-      {
-        nameMatch = (lookup<std::string>(specs, confPath, "name", s_name) == symClass);
-      }
-      catch (SettingIdNotFoundException &ex)
+      if (options.debug)
       {
-        // Global settings have no name
+        // No (locale) settings for the symbol or code
         //
-        scope.push_back(&specs);
-        nameMatch = false;
-      }
-
-      // Enter the block on matching name and for last config entry to load/use the globals
-      //
-      if (nameMatch || ((i == lastIdx) && _hasLocaleGlobals))
-      {
-        if (nameMatch)
-        {
-          symbolIdx = i;
-
-          // Locale
-          //
-          std::string locale(
-              toLower(configValue<std::string>(specs, symClass, "locale", nullptr, s_optional)));
-          bool localeMatch = (locale == options.locale);
+        const char *p =
+            (((spec->symbolIdx < 0) || spec->hasLocaleGlobals || (spec->localeIdx >= 0))
+                 ? "Settings for "
+                 : "Locale specific settings for ");
 
-          if (localeMatch || (locale == ""))
-          {
-            scope.push_back(&specs);
+        debugoutput << p << symClass << " (" << _symCode << ") not found\n";
+      }
 
-            if (localeMatch)
-              localeIdx = i;
-            else
-              hasLocaleGlobals = _hasLocaleGlobals = true;
+      return;
+    }
 
-            // Search for conditional settings based on the documents validTime (it's time value) or
-            // given measurement value
+    const std::string &type = spec->type;
+    std::string code = spec->code;
 
-            const libconfig::Setting *condSpecs =
-                svm ? matchingCondition(
-                          config, confPath, symClass, "", symbolIdx, svm->numericValue())
-                    : matchingCondition(config, confPath, symClass, _symCode, symbolIdx, validtime);
+    std::ostringstream &symbols =
+        (spec->placeHolder.empty() ? symOutput : texts[spec->placeHolder]);
 
-            if (condSpecs)
-              scope.push_back(condSpecs);
-          }
+    if ((type == "svg") || (type == "img"))
+    {
+      const std::string &uri = spec->uri;
+      std::ostringstream wh;
 
-          // Continue searching unless got (new) current block or reached the end of configuration
-          // and there is (new) locale global blocks to use
+      if (uri.empty())
+      {
+        // 'use' reference
+        //
+        double scale = spec->scale;
 
-          if ((!localeMatch) && ((i < lastIdx) || (!_hasLocaleGlobals)))
-            continue;
-        }
+        wh << "<use class=\"" << spec->classDef << "\""
+           << " xlink:href=\"#" << code << "\""
+           << " x=\"" << lon << "\" y=\"" << lat << "\"";
 
-        // Symbol code. May contain folder too; [<folder>/]<code>
+        if (spec->hasScale || trueNorthAdjustment)
+        {
+          wh << std::setprecision(4) << " transform=\"";
 
-        std::string folder;
-        std::string code;
+          if (spec->hasScale)
+            wh << "translate(" << -lon * (scale - 1) << "," << -lat * (scale - 1) << ") scale("
+               << scale << ")";
 
-        if (!areaSymbols)
-        {
-          try
-          {
-            // Note: When rendering wind symbol with wind speed, using primarily 'code' key for
-            //		 symbol mapping (used conditionally to map all wind symbols to 'calm' if
-            // speed
-            // is
-            // nan)
-            //
-            code = getFolderAndSymbol(config,
-                                      &scope,
-                                      confPath,
-                                      symClass,
-                                      _symCode,
-                                      s_code,
-                                      validtime,
-                                      folder,
-                                      svm ? true : false);
-          }
-          catch (SettingIdNotFoundException &ex)
+          if (trueNorthAdjustment)
           {
-            // Symbol code not found
-            //
-            // Clear _hasLocaleGlobals to indicate the settings have been scanned upto current block
-            // and
-            // there's no use to enter here again unless new locale global block(s) or current block
-            // is met
+            // We assume the symbol is centered to 0,0
             //
-            _hasLocaleGlobals = false;
-            continue;
+            wh << " rotate(" << trueNorthAzimuth.Value() << " " << lon << " " << lat << ")";
           }
         }
 
-        // Symbol type; (fill, fill+mask ==>) svg, img or font
-        std::string type = configValue<std::string>(scope, symClass, "type");
-
-        // x- and y- position offsets (mainly to center font symbol glyphs)
-        //
-        int xoffset = 0, yoffset = 0;
-
-        if ((type == "fill") || (type == "fill+mask"))
-          type = "svg";
-        else
+        wh << "\"/>\n";
+      }
+      else
+      {
+        if ((width <= 0) || (height <= 0))
         {
-          bool isSet;
-
-          xoffset = static_cast<int>(
-              floor(configValue<float, int>(scope, symClass, "xoffset", s_optional, &isSet)));
-          if (!isSet)
-            xoffset = 0;
-          yoffset = static_cast<int>(
-              floor(configValue<float, int>(scope, symClass, "yoffset", s_optional, &isSet)));
-          if (!isSet)
-            yoffset = 0;
+          width = spec->width;
+          height = spec->height;
         }
 
-        // Output placeholder; by default output to passed stream. The setting is ignored for
-        // ParameterValueSetArea.
-
-        std::string placeHolder(areaSymbols ? ""
-                                            : boost::algorithm::trim_copy(configValue<std::string>(
-                                                  scope, symClass, "output", s_optional)));
-        std::ostringstream &symbols = (placeHolder.empty() ? symOutput : texts[placeHolder]);
-
-        bool hasWidth, hasHeight;
+        if (spec->hasWidth)
+          wh << " width=\"" << std::fixed << std::setprecision(0) << width << "px\"";
+        else
+          width = 0;
+        if (spec->hasHeight)
+          wh << " height=\"" << std::fixed << std::setprecision(0) << height << "px\"";
+        else
+          height = 0;
+      }
 
-        if ((type == "svg") || (type == "img"))
+      if (!fpos)
+      {
+        if (uri.empty())
+          symbols << wh.str();
+        else
         {
-          // Some settings are required for svg but optional for img
-          //
-          settings reqORopt = ((type == "svg") ? s_required : s_optional);
-          std::ostringstream wh;
-
-          // If symbol url is not given, 'use' reference is generated
-
-          std::string uri =
-              configValue<std::string>(scope, symClass, "url", fpos ? s_required : s_optional);
-
-          if (uri.empty())
-          {
-            std::string classDef = configValue<std::string>(scope, symClass, "class", s_optional);
-            if (classDef.empty())
-              classDef = code;
+          if (trueNorthAdjustment)
+            symbols << "<g transform=\"rotate(" << trueNorthAzimuth.Value() << " " << lon << " "
+                    << lat << ")\">\n";
 
-            bool hasScale;
-            double scale;
-            scale = configValue<double>(scope, symClass, "scale", s_optional, &hasScale);
+          symbols << "<image xlink:href=\"" << svgescape(uri) << "\" x=\"" << std::fixed
+                  << std::setprecision(1) << ((lon - width / 2) - spec->xoffset) << "\" y=\""
+                  << std::fixed << std::setprecision(1) << ((lat - height / 2) + spec->yoffset)
+                  << "\"" << wh.str() << "/>\n";
 
-            wh << "<use class=\"" << classDef << "\""
-               << " xlink:href=\"#" << code << "\""
-               << " x=\"" << lon << "\" y=\"" << lat << "\"";
-
-            if (hasScale || trueNorthAdjustment)
-            {
-              wh << std::setprecision(4) << " transform=\"";
-
-              if (hasScale)
-                wh << "translate(" << -lon * (scale - 1) << "," << -lat * (scale - 1) << ") scale("
-                   << scale << ")";
+          if (trueNorthAdjustment)
+            symbols << "</g>\n";
+        }
+      }
+      else
+      {
+        NFmiFillPositions::const_iterator piter;
+        std::list<std::string>::const_iterator siter;
+        settings s_code((settings)(s_base + 1));
 
-              if (trueNorthAdjustment)
-              {
-                // We assume the symbol is centered to 0,0
-                //
-                wh << " rotate(" << trueNorthAzimuth.Value() << " " << lon << " " << lat << ")";
-              }
-            }
+        if (areaSymbols)
+          siter = areaSymbols->begin();
 
-            wh << "\"/>\n";
-          }
-          else
+        for (piter = fpos->begin(); (piter != fpos->end()); piter++)
+          if (areaSymbols)
           {
-            if (folder.empty())
-              folder = configValue<std::string, int>(scope, symClass, "folder", reqORopt);
+            if (siter == areaSymbols->end())
+              siter = areaSymbols->begin();
 
-            if ((width <= 0) || (height <= 0))
+            if (siter != areaSymbols->end())
             {
-              width = configValue<int>(scope, symClass, "width", reqORopt, &hasWidth);
-              height = configValue<int>(scope, symClass, "height", reqORopt, &hasHeight);
-            }
-            else
-              hasWidth = hasHeight = true;
+              std::string u(uri);
 
-            if (!areaSymbols)
-            {
-              boost::algorithm::replace_all(uri, "%folder%", folder);
-              boost::algorithm::replace_all(uri, "%symbol%", code + "." + type);
-            }
+              // Symbol code may contain folder too; [<folder>/]<code>
 
-            if (hasWidth)
-              wh << " width=\"" << std::fixed << std::setprecision(0) << width << "px\"";
-            else
-              width = 0;
-            if (hasHeight)
-              wh << " height=\"" << std::fixed << std::setprecision(0) << height << "px\"";
-            else
-              height = 0;
-          }
+              std::string symFolder(spec->folder);
+              code = getFolderAndSymbol(
+                  config, nullptr, symClass, symClass, *siter, s_code, validtime, symFolder);
 
-          if (!fpos)
-          {
-            if (uri.empty())
-              symbols << wh.str();
-            else
-            {
-              if (trueNorthAdjustment)
-                symbols << "<g transform=\"rotate(" << trueNorthAzimuth.Value() << " " << lon << " "
-                        << lat << ")\">\n";
+              boost::algorithm::replace_all(u, "%folder%", symFolder);
+              boost::algorithm::replace_all(u, "%symbol%", code + "." + type);
 
-              symbols << "<image xlink:href=\"" << svgescape(uri) << "\" x=\"" << std::fixed
-                      << std::setprecision(1) << ((lon - width / 2) - xoffset) << "\" y=\""
-                      << std::fixed << std::setprecision(1) << ((lat - height / 2) + yoffset)
-                      << "\"" << wh.str() << "/>\n";
+              symbols << "<image xlink:href=\"" << svgescape(u) << "\" x=\"" << std::fixed
+                      << std::setprecision(1) << (piter->x - (width / 2)) << "\" y=\""
+                      << std::fixed << std::setprecision(1) << (piter->y - (height / 2)) << "\""
+                      << wh.str() << "/>\n";
 
-              if (trueNorthAdjustment)
-                symbols << "</g>\n";
+              siter++;
             }
           }
           else
-          {
-            NFmiFillPositions::const_iterator piter;
-            std::list<std::string>::const_iterator siter;
-
-            if (areaSymbols)
-              siter = areaSymbols->begin();
-
-            for (piter = fpos->begin(); (piter != fpos->end()); piter++)
-              if (areaSymbols)
-              {
-                if (siter == areaSymbols->end())
-                  siter = areaSymbols->begin();
-
-                if (siter != areaSymbols->end())
-                {
-                  std::string u(uri);
-
-                  // Symbol code may contain folder too; [<folder>/]<code>
-
-                  std::string symFolder(folder);
-                  code = getFolderAndSymbol(
-                      config, nullptr, symClass, symClass, *siter, s_code, validtime, symFolder);
-
-                  boost::algorithm::replace_all(u, "%folder%", symFolder);
-                  boost::algorithm::replace_all(u, "%symbol%", code + "." + type);
-
-                  symbols << "<image xlink:href=\"" << svgescape(u) << "\" x=\"" << std::fixed
-                          << std::setprecision(1) << (piter->x - (width / 2)) << "\" y=\""
-                          << std::fixed << std::setprecision(1) << (piter->y - (height / 2)) << "\""
-                          << wh.str() << "/>\n";
-
-                  siter++;
-                }
-              }
-              else
-                symbols << "<image xlink:href=\"" << svgescape(uri) << "\" x=\"" << std::fixed
-                        << std::setprecision(1) << (piter->x - (width / 2)) << "\" y=\""
-                        << std::fixed << std::setprecision(1) << (piter->y - (height / 2)) << "\""
-                        << wh.str() << "/>\n";
-          }
-        }
-        else if (type == "font")
-        {
-          // Use last of the given classes for symbol specific class reference
-          //
-          std::string class1 = configValue<std::string>(scope, symClass, "class");
-          boost::trim(class1);
-
-          std::vector<std::string> classes;
-          boost::split(classes, class1, boost::is_any_of(" "));
-
-          std::string class2((class1.empty() ? "" : " ") + classes[classes.size() - 1] +
-                             (symCode.empty() ? symClass : symCode));
-          std::string id = "symbol" + Fmi::to_string(npointsymbols);
-
-          if (!fpos)
-            symbols << "<text class=\"" << class1 << class2 << "\" id=\"" << id << "\" x=\""
-                    << std::fixed << std::setprecision(1) << (lon - xoffset) << "\" y=\""
-                    << std::fixed << std::setprecision(1) << (lat + yoffset) << "\">&#" << code
-                    << ";</text>\n";
-          else
-          {
-            NFmiFillPositions::const_iterator piter;
-
-            for (piter = fpos->begin(); (piter != fpos->end()); piter++)
-              symbols << "<text class=\"" << class1 << class2 << "\" id=\"" << id << "\" x=\""
-                      << std::fixed << std::setprecision(1) << piter->x << "\" y=\"" << std::fixed
-                      << std::setprecision(1) << piter->y << "\">&#" << code << ";</text>\n";
-          }
-        }
-        else
-          throw std::runtime_error(confPath + ": '" + type + "'" + symTypeMsg);
-
-        if (feature)
-        {
-          std::string textOut(feature->text(options.locale));
-
-          if ((!textOut.empty()) && (textOut != options.locale))
-          {
-            // Render feature's infotext. The text is rendered starting from coordinate (0,0) and
-            // final position is selected afterwards. The final position is set as transformation
-            // offsets to the selected position.
-            //
-            // Note: The key for position must sort after the key for the text (the key/text
-            //		 containing the position key must be handled/outputted prior the position
-            // key/text);
-            //		 therefore the position key starts with "Z0"
-            //
-            std::string TEXTPOSid("Z0TEXTPOS_" + symClass +
-                                  Fmi::to_string(npointsymbols));
-            std::string textPosition =
-                configValue<std::string>(scope, symClass, "textposition", s_optional);
-            int textWidth = 0, textHeight = 0, maxTextWidth = 0, fontSize = 0, tXOffset = 0,
-                tYOffset = 0;
-            int areaWidth = static_cast<int>(std::floor(0.5 + area->Width())),
-                areaHeight = static_cast<int>(std::floor(0.5 + area->Height()));
+            symbols << "<image xlink:href=\"" << svgescape(uri) << "\" x=\"" << std::fixed
+                    << std::setprecision(1) << (piter->x - (width / 2)) << "\" y=\""
+                    << std::fixed << std::setprecision(1) << (piter->y - (height / 2)) << "\""
+                    << wh.str() << "/>\n";
+      }
+    }
+    else
+    {
+      // Font symbol
+      //
+      const std::string &class1 = spec->class1;
+      const std::string &class2 = spec->class2;
+      std::string id = "symbol" + Fmi::to_string(npointsymbols);
+
+      if (!fpos)
+        symbols << "<text class=\"" << class1 << class2 << "\" id=\"" << id << "\" x=\""
+                << std::fixed << std::setprecision(1) << (lon - spec->xoffset) << "\" y=\""
+                << std::fixed << std::setprecision(1) << (lat + spec->yoffset) << "\">&#" << code
+                << ";</text>\n";
+      else
+      {
+        NFmiFillPositions::const_iterator piter;
 
-            // The text can start with position, fontsize and x/y offset settings overriding the
-            // configured values.
-            //
-            // Using default symbol/image width and height if not given.
+        for (piter = fpos->begin(); (piter != fpos->end()); piter++)
+          symbols << "<text class=\"" << class1 << class2 << "\" id=\"" << id << "\" x=\""
+                  << std::fixed << std::setprecision(1) << piter->x << "\" y=\"" << std::fixed
+                  << std::setprecision(1) << piter->y << "\">&#" << code << ";</text>\n";
+      }
+    }
 
-            textSettings(textOut, textPosition, maxTextWidth, fontSize, tXOffset, tYOffset);
+    if (feature)
+    {
+      std::string textOut(feature->text(options.locale));
 
-            render_text(texts,
-                        confPath,
-                        symClass,
-                        NFmiStringTools::UrlDecode(textOut),
+      if ((!textOut.empty()) && (textOut != options.locale))
+      {
+        // Render feature's infotext. The text is rendered starting from coordinate (0,0) and
+        // final position is selected afterwards. The final position is set as transformation
+        // offsets to the selected position.
+        //
+        // Note: The key for position must sort after the key for the text (the key/text
+        //		 containing the position key must be handled/outputted prior the position
+        // key/text);
+        //		 therefore the position key starts with "Z0"
+        //
+        std::string TEXTPOSid("Z0TEXTPOS_" + symClass +
+                              Fmi::to_string(npointsymbols));
+        std::list<const libconfig::Setting *> scope(spec->scope);
+        std::string textPosition =
+            configValue<std::string>(scope, symClass, "textposition", s_optional);
+        int textWidth = 0, textHeight = 0, maxTextWidth = 0, fontSize = 0, tXOffset = 0,
+            tYOffset = 0;
+        int areaWidth = static_cast<int>(std::floor(0.5 + area->Width())),
+            areaHeight = static_cast<int>(std::floor(0.5 + area->Height()));
+
+        // The text can start with position, fontsize and x/y offset settings overriding the
+        // configured values.
+        //
+        // Using default symbol/image width and height if not given.
+
+        textSettings(textOut, textPosition, maxTextWidth, fontSize, tXOffset, tYOffset);
+
+        render_text(texts,
+                    confPath,
+                    symClass,
+                    NFmiStringTools::UrlDecode(textOut),
+                    textWidth,
+                    textHeight,
+                    true,
+                    false,
+                    false,
+                    TEXTPOSid,
+                    false,
+                    &maxTextWidth,
+                    &fontSize,
+                    &tXOffset,
+                    &tYOffset);
+
+        if (width == 0)
+          width = defaultSymbolWidth;
+        if (height == 0)
+          height = defaultSymbolHeight;
+
+        Path::BBox bbox(lon - (width / 2.0),
+                        lat - (height / 2.0),
+                        lon + (width / 2.0),
+                        lat + (height / 2.0));
+
+        // To position the text centered to the symbol should one wish so
+
+        NFmiFillRect infoTextRect(std::make_pair(
+            Point(lon - (textWidth / 2.0), lat - (textHeight / 2.0)), Point(0, 0)));
+
+        setTextPosition(Path(),
+                        TEXTPOSid,
+                        textPosition,
+                        infoTextRect,
+                        areaWidth,
+                        areaHeight,
                         textWidth,
                         textHeight,
-                        true,
-                        false,
-                        false,
-                        TEXTPOSid,
-                        false,
-                        &maxTextWidth,
-                        &fontSize,
-                        &tXOffset,
-                        &tYOffset);
-
-            if (width == 0)
-              width = defaultSymbolWidth;
-            if (height == 0)
-              height = defaultSymbolHeight;
-
-            Path::BBox bbox(lon - (width / 2.0),
-                            lat - (height / 2.0),
-                            lon + (width / 2.0),
-                            lat + (height / 2.0));
-
-            // To position the text centered to the symbol should one wish so
-
-            NFmiFillRect infoTextRect(std::make_pair(
-                Point(lon - (textWidth / 2.0), lat - (textHeight / 2.0)), Point(0, 0)));
-
-            setTextPosition(Path(),
-                            TEXTPOSid,
-                            textPosition,
-                            infoTextRect,
-                            areaWidth,
-                            areaHeight,
-                            textWidth,
-                            textHeight,
-                            tXOffset,
-                            tYOffset,
-                            &bbox);
-          }
-        }
-
-        return;
-      }  // if
-    }    // for
-
-    if (options.debug)
-    {
-      // No (locale) settings for the symbol or code
-      //
-      const char *p = (((symbolIdx < 0) || hasLocaleGlobals || (localeIdx >= 0))
-                           ? "Settings for "
-                           : "Locale specific settings for ");
-
-      debugoutput << p << symClass << " (" << _symCode << ") not found\n";
+                        tXOffset,
+                        tYOffset,
+                        &bbox);
+      }
     }
   }
   catch (libconfig::SettingNotFoundException &ex)
@@ -4648,7 +4934,8 @@ void SvgRenderer::render_cloudSymbol(const std::string &confPath,
   // Search for conditional settings based on cloud height in px
 
   double hpx = lopx - hipx;
-  const libconfig::Setting *condSpecs = matchingCondition(config, confPath, confPath, "", -1, hpx);
+  const libconfig::Setting *condSpecs =
+      matchingCondition(configResolver, confPath, confPath, "", -1, hpx);
 
   // Set active configuration scope
 
@@ -5453,7 +5740,7 @@ void adjustMarkerPosition(double minx,
 
 void getAreaMarkerPos(Texts &texts,
                       const std::string &markerId,
-                      const std::list<DirectPosition> &curvePoints,
+                      const std::vector<DirectPosition> &curvePoints,
                       NFmiFillAreas &holeAreas,
                       FillAreas &reservedAreas,
                       FillAreas &freeAreas,
@@ -5491,8 +5778,9 @@ void getAreaMarkerPos(Texts &texts,
 
   NFmiFillMap fillMap;
   NFmiFillAreas fillAreas;
-  std::list<DirectPosition>::const_iterator cpend = curvePoints.end(), itcp = curvePoints.begin(),
-                                            pitcp = curvePoints.begin();
+  std::vector<DirectPosition>::const_iterator cpend = curvePoints.end(),
+                                              itcp = curvePoints.begin(),
+                                              pitcp = curvePoints.begin();
   std::list<std::string> markerChain;
   double mw = markerWidth, mh = markerHeight, lopx, mx, my, xScale = 1.0, yScale = 1.0;
   size_t nMarkers = 0;
@@ -6075,7 +6363,7 @@ void getAreaMarkerPos(Texts &texts,
  */
 // ----------------------------------------------------------------------
 
-void SvgRenderer::renderAreaLabels(const std::list<DirectPosition> &curvePoints,
+void SvgRenderer::renderAreaLabels(const std::vector<DirectPosition> &curvePoints,
                                    NFmiFillAreas &holeAreas,
                                    const std::string &confPath,
                                    const std::string &textName,
@@ -6201,7 +6489,7 @@ void SvgRenderer::renderAreaLabels(const std::list<DirectPosition> &curvePoints,
 
 template <typename T>
 void SvgRenderer::renderAreaSymbols(const T &cg,
-                                    const std::list<DirectPosition> &curvePoints,
+                                    const std::vector<DirectPosition> &curvePoints,
                                     NFmiFillAreas &holeAreas,
                                     const std::string &confPath,
                                     const std::string &symbolPosId,
@@ -6362,20 +6650,68 @@ bool CategoryValueMeasureGroup::groupMember(bool first, const woml::CategoryValu
   else if (cvm->groupNumber() != itsFirstMember->groupNumber())
     return false;
 
-  return true;
+  return true;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Group membership detection
+ */
+// ----------------------------------------------------------------------
+
+template <typename T>
+GroupCategory<T>::GroupCategory() : CategoryValueMeasureGroup(), isCompiled(false)
+{
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Index the groups by member type
+ */
+// ----------------------------------------------------------------------
+
+template <typename T>
+void GroupCategory<T>::compileTypes() const
+{
+  itsTypeGroups.clear();
+
+  for (GroupIterator it = itsGroups.begin(); (it != itsGroups.end()); it++)
+    for (const std::string &type : it->types())
+      itsTypeGroups.insert(std::make_pair(type, it));  // Keeps the first group
+
+  isCompiled = true;
 }
 
 // ----------------------------------------------------------------------
 /*!
- * \brief Group membership detection
+ * \brief Get the first group containing given member type
  */
 // ----------------------------------------------------------------------
 
 template <typename T>
-GroupCategory<T>::GroupCategory() : CategoryValueMeasureGroup()
+typename GroupCategory<T>::GroupIterator GroupCategory<T>::typeGroup(
+    const std::string &theMemberType) const
 {
+  // Types containing separators can match a sequence of group's types; search them as before
+
+  if (theMemberType.empty() || (theMemberType.find(',') != std::string::npos))
+    return std::find_if(
+        itsGroups.begin(), itsGroups.end(), std::bind(MemberType(), p::_1, theMemberType));
+
+  if (!isCompiled)
+    compileTypes();
+
+  auto it = itsTypeGroups.find(theMemberType);
+
+  return ((it != itsTypeGroups.end()) ? it->second : itsGroups.end());
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Group membership detection
+ */
+// ----------------------------------------------------------------------
+
 template <typename T>
 bool GroupCategory<T>::groupMember(const woml::CategoryValueMeasure *cvm) const
 {
@@ -6386,8 +6722,7 @@ bool GroupCategory<T>::groupMember(const woml::CategoryValueMeasure *cvm) const
 
   std::string category(boost::algorithm::to_upper_copy(cvm->category()));
 
-  return (std::find_if(itsGroups.begin(), itsGroups.end(), std::bind(MemberType(), p::_1, category)) !=
-          itsGroups.end());
+  return (typeGroup(category) != itsGroups.end());
 }
 
 template <typename T>
@@ -6402,7 +6737,7 @@ bool GroupCategory<T>::groupMember(bool first, const woml::CategoryValueMeasure
 
   if (first)
   {
-    itcg = std::find_if(itsGroups.begin(), itsGroups.end(), std::bind(MemberType(), p::_1, category));
+    itcg = typeGroup(category);
 
     if (itcg == itsGroups.end())
       throw std::runtime_error("GroupCategory::groupMember: unknown category '" + category + "'");
@@ -6417,9 +6752,7 @@ bool GroupCategory<T>::groupMember(bool first, const woml::CategoryValueMeasure
   {
     // Check if elevations overlap (have the same group number) and have matching category
     //
-    if ((!CategoryValueMeasureGroup::groupMember(false, cvm)) ||
-        (std::find_if(itsGroups.begin(), itsGroups.end(), std::bind(MemberType(), p::_1, category)) !=
-         itcg))
+    if ((!CategoryValueMeasureGroup::groupMember(false, cvm)) || (typeGroup(category) != itcg))
       return false;
   }
 
@@ -6695,8 +7028,6 @@ bool SvgRenderer::scaledCurvePositions(ElevGrp &eGrp,
   double axisWidth = axisManager->axisWidth(), xStep = axisManager->xStep(),
          nonZ = axisManager->nonZeroElevation();
 
-  srand(time(nullptr));
-
   // x -offset for additional points generated on both sides of the elevation's lo/hi range points
   // can't exceed
   // half of the timestep width (an intermediate point is always generated halfway of subsequent
@@ -6747,8 +7078,8 @@ bool SvgRenderer::scaledCurvePositions(ElevGrp &eGrp,
 
     if (scaleHeightRandom > 0)
     {
-      lOffset += ((scaleHeightRandom + 1) * (rand() / (RAND_MAX + 1.0)));
-      hOffset += ((scaleHeightRandom + 1) * (rand() / (RAND_MAX + 1.0)));
+      lOffset += ((scaleHeightRandom + 1) * uniformRandom(randomGenerator));
+      hOffset += ((scaleHeightRandom + 1) * uniformRandom(randomGenerator));
     }
 
     lopx0 = lopx = axisManager->scaledElevation(lo);
@@ -7156,17 +7487,20 @@ void SvgRenderer::render_timeserie(const woml::CloudLayers &cloudlayers)
   int nGroups = 0;
 
   std::vector<DirectPosition> curvePositions, curvePositions0;
-  std::list<DirectPosition> curvePoints, curvePoints0;
-  std::list<DoubleArr> decoratorPoints;
-
-  // Set unique group number for members of each overlapping group of elevations
+  std::vector<DirectPosition> curvePoints, curvePoints0;
+  std::vector<DoubleArr> decoratorPoints;
 
-  setGroupNumbers(ts);
-
-  // Search and flag elevation holes
+  // Set unique group number for members of each overlapping group of elevations,
+  // and search and flag elevation holes unless already done
 
   NFmiFillAreas holeAreas;
-  bool hasHole = searchHoles(ts, &cloudGroupCategory);
+  bool hasHole;
+
+  if (!preparedTimeserie(ts, hasHole))
+  {
+    setGroupNumbers(ts);
+    hasHole = searchHoles(ts, &cloudGroupCategory);
+  }
 
   Fmi::DateTime bt, et;
 
@@ -7269,15 +7603,16 @@ void SvgRenderer::render_timeserie(const woml::CloudLayers &cloudlayers)
     // stroke=\"black\" stroke-width=\"1\" fill=\"blue\"/>"; } std::cerr << std::endl << "<<< PNT";
     // }
     BezierModel bm(curvePositions, true, tightness);
-    bm.getSteppedCurvePoints(itcg->baseStep(), itcg->maxRand(), itcg->maxRepeat(), curvePoints);
+    bm.getSteppedCurvePoints(
+        itcg->baseStep(), itcg->maxRand(), itcg->maxRepeat(), curvePoints, randomGenerator);
 
     if (borderCompensation)
     {
       BezierModel bm0(curvePositions0, true, tightness);
-      bm0.getSteppedCurvePoints(itcg->baseStep(), 0, 0, curvePoints0);
+      bm0.getSteppedCurvePoints(itcg->baseStep(), 0, 0, curvePoints0, randomGenerator);
     }
     //{ std::cerr << std::fixed << std::setprecision(1);
-    // std::list<DirectPosition>::iterator cpbeg = curvePoints.begin(),cpend =
+    // std::vector<DirectPosition>::iterator cpbeg = curvePoints.begin(),cpend =
     // curvePoints.end(),itcp; size_t n = 0;
     // for (itcp = cpbeg; (itcp != cpend); itcp++, n++) {
     // if ((n % 10) == 0) std::cerr << std::endl << n << ": "; else std::cerr << " "; std::cerr <<
@@ -7289,36 +7624,33 @@ void SvgRenderer::render_timeserie(const woml::CloudLayers &cloudlayers)
                      itcg->scaleHeightRandom(),
                      itcg->controlMin(),
                      itcg->controlRandom(),
-                     decoratorPoints);
+                     decoratorPoints,
+                     randomGenerator);
 
     // Render path
 
-    std::list<DirectPosition>::const_iterator cpbeg = curvePoints.begin(),
-                                              cpend = curvePoints.end(), itcp;
-    std::list<DoubleArr>::const_iterator itdp = decoratorPoints.begin();
-
-    if (options.debug)
-    {
-      path.clear();
-      path.str("");
-    }
+    std::vector<DirectPosition>::const_iterator cpbeg = curvePoints.begin(),
+                                                cpend = curvePoints.end(), itcp;
+    std::vector<DoubleArr>::const_iterator itdp = decoratorPoints.begin();
 
     if (!asSymbol)
     {
+      CoordinateWriter &decorated = pathWriter(3);
+
       for (itcp = cpbeg; (itcp != cpend); itcp++)
       {
+        double x = itcp->getX(), y = itcp->getY();
+
         if (itcp == cpbeg)
-          path << "M";
+          decorated.moveTo(x, y);
         else
         {
-          path << " Q" << itdp->getX() << "," << itdp->getY();
+          decorated.quadTo(itdp->getX(), itdp->getY(), x, y);
           // pnts << "<circle cx=\"" << (*itdp)[0] << "\" cy=\"" << (*itdp)[1]+150 << "\" r=\"5\"
           // stroke=\"black\" stroke-width=\"1\" fill=\"yellow\"/>";
           itdp++;
         }
 
-        double x = itcp->getX(), y = itcp->getY();
-
         if ((!isHole) && (x >= 0) && (x < (axisWidth + 1)))
         {
           if (y > 0)
@@ -7327,13 +7659,12 @@ void SvgRenderer::render_timeserie(const woml::CloudLayers &cloudlayers)
             aboveTop = true;
         }
 
-        path << " " << x << "," << y;
         // pnts << "<circle cx=\"" << x << "\" cy=\"" << y/*+150*/ << "\" r=\"3\" stroke=\"black\"
         // stroke-width=\"1\" fill=\"red\"/>";
       }
 
       texts[itcg->placeHolder()] << "<path class=\"" << itcg->classDef() << "\" id=\""
-                                 << "CloudLayers" << nGroups << "\" d=\"" << path.str() << "\"/>\n";
+                                 << "CloudLayers" << nGroups << "\" d=\"" << decorated << "\"/>\n";
       // texts[itcg->placeHolder()] << "<path class=\"" << itcg->classDef()
       //						   << "\" id=\"" << "CloudLayers" << nGroups
       //						   << "\" d=\""
@@ -7682,62 +8013,46 @@ SvgRenderer::ElevationGroupType SvgRenderer::elevationGroup(
  */
 // ----------------------------------------------------------------------
 
-void SvgRenderer::checkLeftSide(ElevGrp &eGrp,
+void SvgRenderer::checkLeftSide(const ElevationIndex &index,
                                 ElevationHole &hole,
                                 CategoryValueMeasureGroup *groupCategory)
 {
-  std::reverse_iterator<ElevGrp::iterator> egend(eGrp.begin()), liteg(hole.aboveElev);
-  Fmi::DateTime vt = hole.aboveElev->validTime();
+  // Check if the left side of the hole is closed or bounded above by the elevations of the
+  // previous time instant, scanning them in reverse order.
+
+  std::optional<size_t> leftTime = index.previousTime(index.timeIndex(hole.aboveElev->validTime()));
 
-  // Check if the left side of the hole is closed or bounded above.
+  if (!leftTime)
+    return;
 
-  for (; (liteg != egend); liteg++)
+  for (size_t i = index.timeEnd(*leftTime); (i > index.timeBegin(*leftTime)); i--)
   {
-    int dh = (liteg->validTime() - vt).hours();
+    const ElevationIndex::Range &range = index[i - 1];
 
-    if (dh == -1)
+    if (groupCategory)
     {
-      if (groupCategory)
-      {
-        // Check that elevation belongs to the same category (cloud type or icing/turbulence
-        // magnitude) as the hole
-        //
-        ElevGrp::iterator iteg = liteg.base();
-        iteg--;
-
-        if (!checkCategory(groupCategory, hole.aboveElev, iteg))
-          continue;
-      }
+      // Check that elevation belongs to the same category (cloud type or icing/turbulence
+      // magnitude) as the hole
+      //
+      ElevGrp::iterator iteg = range.iteg;
 
-      const woml::Elevation &e = liteg->Pv()->elevation();
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-          (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-          (e.bounded() ? itsBoundedLo : e.value());
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
-          (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
-          (e.bounded() ? itsBoundedHi : e.value());
+      if (!checkCategory(groupCategory, hole.aboveElev, iteg))
+        continue;
+    }
 
-      double lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-      double hi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
+    if (range.hi < hole.hi)
+      continue;
 
-      if (hi < hole.hi)
-        continue;
+    double lo = range.lo;
 
-      if ((lo > 0.0) && (lo < axisManager->nonZeroElevation()))
-        lo = 0.0;
+    if ((lo > 0.0) && (lo < axisManager->nonZeroElevation()))
+      lo = 0.0;
 
-      hole.leftAboveBounded = true;
-      hole.leftClosed = (lo <= hole.lo);
+    hole.leftAboveBounded = true;
+    hole.leftClosed = (lo <= hole.lo);
 
-      return;
-    }
-    else if (dh != 0)
-      return;
+    return;
   }
-
-  return;
 }
 
 // ----------------------------------------------------------------------
@@ -7798,63 +8113,49 @@ bool SvgRenderer::checkLeftSideHoles(ElevationHoles &holes,
  */
 // ----------------------------------------------------------------------
 
-void SvgRenderer::checkRightSide(ElevGrp &eGrp,
+void SvgRenderer::checkRightSide(const ElevationIndex &index,
                                  ElevationHoles::iterator &iteh,
                                  CategoryValueMeasureGroup *groupCategory)
 {
-  // Check if the right side of the hole is closed.
+  // Check if the right side of the hole is closed by the elevations of the next time instant.
+
+  std::optional<size_t> rightTime = index.nextTime(index.timeIndex(iteh->belowElev->validTime()));
 
-  ElevGrp::iterator egend = eGrp.end(), riteg = iteh->belowElev;
-  Fmi::DateTime vt = riteg->validTime();
+  if (!rightTime)
+    return;
 
-  for (riteg++; (riteg != egend); riteg++)
+  for (size_t i = index.timeBegin(*rightTime); (i < index.timeEnd(*rightTime)); i++)
   {
-    int dh = (riteg->validTime() - vt).hours();
+    const ElevationIndex::Range &range = index[i];
 
-    if (dh == 1)
+    if (groupCategory)
     {
-      if (groupCategory)
-      {
-        // Check that elevation belongs to the same category (cloud type or icing/turbulence
-        // magnitude) as the hole
-        //
-        if (!checkCategory(groupCategory, iteh->aboveElev, riteg))
-          continue;
-      }
-
-      const woml::Elevation &e = riteg->Pv()->elevation();
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-          (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-          (e.bounded() ? itsBoundedLo : e.value());
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
-          (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
-          (e.bounded() ? itsBoundedHi : e.value());
+      // Check that elevation belongs to the same category (cloud type or icing/turbulence
+      // magnitude) as the hole
+      //
+      ElevGrp::iterator iteg = range.iteg;
 
-      double lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-      double hi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
+      if (!checkCategory(groupCategory, iteh->aboveElev, iteg))
+        continue;
+    }
 
-      if (hi >= iteh->hi)
-      {
-        iteh->rightAboveBounded = true;
+    if (range.hi >= iteh->hi)
+    {
+      iteh->rightAboveBounded = true;
 
-        if ((lo > 0.0) && (lo < axisManager->nonZeroElevation()))
-          lo = 0.0;
+      double lo = range.lo;
 
-        if (lo > iteh->lo)
-          continue;
+      if ((lo > 0.0) && (lo < axisManager->nonZeroElevation()))
+        lo = 0.0;
 
-        iteh->rightClosed = true;
-      }
+      if (lo > iteh->lo)
+        continue;
 
-      return;
+      iteh->rightClosed = true;
     }
-    else if (dh != 0)
-      return;
-  }
 
-  return;
+    return;
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -7994,6 +8295,7 @@ bool SvgRenderer::checkBothSideHoles(ElevationHoles &holes,
 // ----------------------------------------------------------------------
 
 bool SvgRenderer::checkHoles(ElevGrp &eGrp,
+                             const ElevationIndex &index,
                              ElevationHoles &holes,
                              CategoryValueMeasureGroup *groupCategory,
                              bool setNegative)
@@ -8010,7 +8312,7 @@ bool SvgRenderer::checkHoles(ElevGrp &eGrp,
       iteh->leftClosed = true;
 
     if (iteh->leftClosed)
-      checkRightSide(eGrp, iteh, groupCategory);
+      checkRightSide(index, iteh, groupCategory);
   }
 
   // Check if the the holes are closed by both side closed holes on the right side.
@@ -8281,32 +8583,25 @@ bool SvgRenderer::searchHoles(const std::list<woml::TimeSeriesSlot> &ts,
   {
     // For categorized data the elevations are scanned one category (cloud type or icing/turbulence
     // magnitude) at a time.
-    // Elevations with unknown category are first removed from the underlying woml object
-    // collection.
+    // Elevations with unknown category are first removed from the group; the underlying woml
+    // object collection is not modified, the elevations are skipped when rendering too.
     //
-    bool reLoad = false;
-
-    for (iteg = egbeg; (iteg != egend); iteg++)
+    for (iteg = egbeg; (iteg != egend);)
       if (!checkCategory(groupCategory, iteg))
-      {
-        iteg->Pvs()->get()->editableValues().erase(iteg->Pv());
-        iteg->isDeleted(true);
-
-        reLoad = true;
-      }
-
-    if (reLoad)
-    {
-      elevationGroup(ts, bt, et, eGrp, true, false);
+        iteg = eGrp.erase(iteg);
+      else
+        iteg++;
 
-      egbeg = eGrp.begin();
-      egend = eGrp.end();
-    }
+    egbeg = eGrp.begin();
   }
 
   double nonZ = axisManager->nonZeroElevation(), lo = 0.0, plo = 0.0, hi = 0.0, phi = 0.0;
   bool scanned = true, reScan;
 
+  // Elevation ranges indexed by time instant for checking the sides of the holes; rebuilt when
+  // hole elevations are generated
+
+  std::optional<ElevationIndex> index;
   ElevationHoles holes;
 
   do
@@ -8347,6 +8642,7 @@ bool SvgRenderer::searchHoles(const std::list<woml::TimeSeriesSlot> &ts,
           // ground.
           //
           generateHoleElevation(eGrp, piteg, iteg);
+          index.reset();
           scanned = false;
 
           continue;
@@ -8379,7 +8675,10 @@ bool SvgRenderer::searchHoles(const std::list<woml::TimeSeriesSlot> &ts,
             hole.hi = plo;
             hole.hiHi = phi;
 
-            checkLeftSide(eGrp, hole, groupCategory);
+            if (!index)
+              index.emplace(eGrp);
+
+            checkLeftSide(*index, hole, groupCategory);
 
             holes.push_back(hole);
           }
@@ -8413,7 +8712,10 @@ bool SvgRenderer::searchHoles(const std::list<woml::TimeSeriesSlot> &ts,
   // are
   // deleted.
 
-  return checkHoles(eGrp, holes, groupCategory, setNegative);
+  if (!index)
+    index.emplace(eGrp);
+
+  return checkHoles(eGrp, *index, holes, groupCategory, setNegative);
 }
 
 // ----------------------------------------------------------------------
@@ -8448,10 +8750,13 @@ void SvgRenderer::render_timeserie(const woml::Contrails &contrails)
 
     const std::string classDef = configValue<std::string>(specs, confPath, "class");
 
-    // Set unique group number for members of each overlapping group of elevations.
-    // Do not mix ground and nonground elevations.
+    // Set unique group number for members of each overlapping group of elevations
+    // unless already done. Do not mix ground and nonground elevations.
+
+    bool hasHole;
 
-    setGroupNumbers(ts, false);
+    if (!preparedTimeserie(ts, hasHole))
+      setGroupNumbers(ts, false);
 
     Fmi::DateTime bt, et;
 
@@ -8982,16 +9287,19 @@ void SvgRenderer::render_timeserie(const std::list<woml::TimeSeriesSlot> &ts,
   int nGroups = 0;
 
   std::vector<DirectPosition> curvePositions;
-  std::list<DirectPosition> curvePoints;
+  std::vector<DirectPosition> curvePoints;
 
-  // Set unique group number for members of each overlapping group of elevations
-
-  setGroupNumbers(ts);
-
-  // Search and flag elevation holes
+  // Set unique group number for members of each overlapping group of elevations,
+  // and search and flag elevation holes unless already done
 
   NFmiFillAreas holeAreas;
-  bool hasHole = searchHoles(ts, &groupCategory);
+  bool hasHole;
+
+  if (!preparedTimeserie(ts, hasHole))
+  {
+    setGroupNumbers(ts);
+    hasHole = searchHoles(ts, &groupCategory);
+  }
 
   Fmi::DateTime bt, et;
 
@@ -9066,12 +9374,12 @@ void SvgRenderer::render_timeserie(const std::list<woml::TimeSeriesSlot> &ts,
       // Create bezier curve and get curve points
 
       BezierModel bm(curvePositions, true, tightness);
-      bm.getSteppedCurvePoints(0, 0, 0, curvePoints);
+      bm.getSteppedCurvePoints(0, 0, 0, curvePoints, randomGenerator);
 
       // Render path
 
-      std::list<DirectPosition>::iterator cpbeg = curvePoints.begin(), cpend = curvePoints.end(),
-                                          itcp;
+      std::vector<DirectPosition>::iterator cpbeg = curvePoints.begin(),
+                                            cpend = curvePoints.end(), itcp;
 
       if (options.debug)
       {
@@ -9304,6 +9612,44 @@ WindArrowOffsets calculateWindArrowOffsets(unsigned int arrowArmLength, double w
   return windArrowOffsets;
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get id of wind arrow symbol definition for given symbol, scale
+ *		  and (quantised) direction. The symbol is rotated, scaled and
+ *		  offset to position the arrowhead to the elevation line, thus
+ *		  the arrows can be rendered by position only. New definitions
+ *		  are written to 'defs'.
+ */
+// ----------------------------------------------------------------------
+
+const std::string &SvgRenderer::windArrowSymbol(const std::string &href,
+                                                const std::string &classDef,
+                                                double scale,
+                                                unsigned int arrowArmLength,
+                                                double windDirection,
+                                                std::ostringstream &defs)
+{
+  std::ostringstream key;
+  key << href << ' ' << classDef << ' ' << std::fixed << std::setprecision(1) << scale << ' '
+      << arrowArmLength << ' ' << windDirection;
+
+  auto it = windArrowSymbols.find(key.str());
+
+  if (it != windArrowSymbols.end())
+    return it->second;
+
+  std::string id("WindArrow" + Fmi::to_string(windArrowSymbols.size()));
+  WindArrowOffsets windArrowOffsets = calculateWindArrowOffsets(arrowArmLength, windDirection);
+
+  defs << "<g id=\"" << id << "\" class=\"" << classDef << "\" transform=\"translate("
+       << std::fixed << std::setprecision(1) << (scale * windArrowOffsets.horizontalOffsetPx) << ","
+       << (-scale * windArrowOffsets.verticalOffsetPx) << ") scale(" << scale << ")\">\n"
+       << "<use transform=\"rotate(" << windDirection << ")\" xlink:href=\"" << svgescape(href)
+       << "\"/>\n</g>\n";
+
+  return (windArrowSymbols[key.str()] = id);
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Wind rendering
@@ -9377,6 +9723,22 @@ void SvgRenderer::render_timeserie(const woml::Winds &winds)
     std::string WINDEXTRA((useWindBase && autoWindBase) ? WINDAUTO : WINDEXTRAOUT);
     std::string WINDXPOS("--WINDXPOS--");
 
+    // Controls to render the wind arrows as references to symbol definitions, one for each
+    // symbol, scale and direction (default: false), and the direction step in degrees to
+    // quantise the directions to (default: 1)
+
+    bool useDefs = configValue<bool>(specs, confPath, "usedefs", nullptr, s_optional, &isSet);
+    if (!isSet)
+      useDefs = false;
+
+    double directionStep =
+        configValue<double, int>(specs, confPath, "directionstep", nullptr, s_optional, &isSet);
+    if (!isSet)
+      directionStep = 1.0;
+    else if (directionStep <= 0.0)
+      throw std::runtime_error(confPath + ": directionstep must be positive");
+
+    std::ostringstream windDefs;
     double firstXPos = 0.0;
 
     std::list<WindArrowOffsets> windArrowOffsetsList;
@@ -9454,7 +9816,7 @@ void SvgRenderer::render_timeserie(const woml::Winds &winds)
             }
 
           const libconfig::Setting *condSpecs =
-              matchingCondition(config, confPath, confPath, "", -1, ws);
+              matchingCondition(configResolver, confPath, confPath, "", -1, ws);
 
           if (condSpecs)
           {
@@ -9516,9 +9878,20 @@ void SvgRenderer::render_timeserie(const woml::Winds &winds)
             if (y < 0)
               continue;
 
-            // Get position offsets and adjust y -coordinate
+            // Get position offsets and adjust y -coordinate. Symbol definitions contain the
+            // offsets
+
+            std::string symbolId;
 
-            windArrowOffsets = calculateWindArrowOffsets(arrowArmLength, wd);
+            if (useDefs)
+            {
+              wd = directionStep * std::round(wd / directionStep);
+              symbolId = windArrowSymbol(
+                  uri + "#" + symbol, classDef, scale, arrowArmLength, wd, windDefs);
+              windArrowOffsets = WindArrowOffsets();
+            }
+            else
+              windArrowOffsets = calculateWindArrowOffsets(arrowArmLength, wd);
 
             y -= ((windArrowOffsets.scale = scale) * windArrowOffsets.verticalOffsetPx);
 
@@ -9553,13 +9926,18 @@ void SvgRenderer::render_timeserie(const woml::Winds &winds)
 
               // Wind symbol
               //
-              texts[WINDBASE] << "<g transform=\"translate(" << windXPos << "," << std::fixed
-                              << std::setprecision(1) << y << ") scale(" << std::fixed
-                              << std::setprecision(1) << scale << ")\" class=\"" << classDef
-                              << "\">\n"
-                              << "<use transform=\"rotate(" << std::fixed << std::setprecision(1)
-                              << wd << ")\" xlink:href=\"" << svgescape(uri + "#" + symbol)
-                              << "\"/>\n</g>\n";
+              if (useDefs)
+                texts[WINDBASE] << "<use x=\"" << windXPos << "\" y=\"" << std::fixed
+                                << std::setprecision(1) << y << "\" xlink:href=\"#" << symbolId
+                                << "\"/>\n";
+              else
+                texts[WINDBASE] << "<g transform=\"translate(" << windXPos << "," << std::fixed
+                                << std::setprecision(1) << y << ") scale(" << std::fixed
+                                << std::setprecision(1) << scale << ")\" class=\"" << classDef
+                                << "\">\n"
+                                << "<use transform=\"rotate(" << std::fixed << std::setprecision(1)
+                                << wd << ")\" xlink:href=\"" << svgescape(uri + "#" + symbol)
+                                << "\"/>\n</g>\n";
 
               nSymbols++;
             }
@@ -9576,14 +9954,20 @@ void SvgRenderer::render_timeserie(const woml::Winds &winds)
                                    << std::setprecision(1) << bgXPos << ",0)\" xlink:href=\""
                                    << href << "\"/>\n";
 
-                texts[WINDEXTRA] << "<g transform=\"translate(" << std::fixed
-                                 << std::setprecision(1) << windXPos << "," << std::fixed
-                                 << std::setprecision(1) << y << ") scale(" << std::fixed
-                                 << std::setprecision(1) << scale << ")\" class=\"" << classDef
-                                 << "\">\n"
-                                 << "<use transform=\"rotate(" << std::fixed << std::setprecision(1)
-                                 << wd << ")\" xlink:href=\"" << svgescape(uri + "#" + symbol)
-                                 << "\"/>\n</g>\n";
+                if (useDefs)
+                  texts[WINDEXTRA] << "<use x=\"" << std::fixed << std::setprecision(1)
+                                   << windXPos << "\" y=\"" << y << "\" xlink:href=\"#"
+                                   << symbolId << "\"/>\n";
+                else
+                  texts[WINDEXTRA] << "<g transform=\"translate(" << std::fixed
+                                   << std::setprecision(1) << windXPos << "," << std::fixed
+                                   << std::setprecision(1) << y << ") scale(" << std::fixed
+                                   << std::setprecision(1) << scale << ")\" class=\"" << classDef
+                                   << "\">\n"
+                                   << "<use transform=\"rotate(" << std::fixed
+                                   << std::setprecision(1) << wd << ")\" xlink:href=\""
+                                   << svgescape(uri + "#" + symbol)
+                                   << "\"/>\n</g>\n";
 
                 nSymbols++;
 
@@ -9632,6 +10016,13 @@ void SvgRenderer::render_timeserie(const woml::Winds &winds)
       }
     }
 
+    // Symbol definitions are written along with the symbols of the first time instant
+
+    if (!windDefs.str().empty())
+      texts[(useWindBase && ((!autoWindBase) || singleTime)) ? WINDBASEOUT : WINDEXTRAOUT]
+          << "<defs>\n"
+          << windDefs.str() << "</defs>\n";
+
     return;
   }
   catch (libconfig::ConfigException &ex)
@@ -9660,233 +10051,47 @@ void SvgRenderer::checkZeroToleranceGroup(ElevGrp &eGrpIn, ElevGrp &eGrpOut, boo
   // time instant does not have elevation with lo -range <= (or near) 0
 
   double nonZ = axisManager->nonZeroElevation();
+  ElevationIndex index(eGrpIn);
 
-  ElevGrp::reverse_iterator rbegiter(eGrpIn.end()), renditer(eGrpIn.begin()), riteg, priteg;
-  bool groundConnected = true;
+  // The elevations of a time instant are ground connected if the last elevation is.
+  //
+  // If ground connection was detected before, the condition will remain;
+  // the call below won't clear it even if called with false
 
-  for (riteg = priteg = rbegiter; (riteg != renditer); riteg++)
+  for (size_t t = 0; (t < index.timeCount()); t++)
   {
-    if ((riteg == rbegiter) || (riteg->validTime() != priteg->validTime()))
-    {
-      const woml::Elevation &e = riteg->elevation();
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-          (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-          (e.bounded() ? itsBoundedLo : e.value());
-
-      double lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
+    bool groundConnected = (index[index.timeEnd(t) - 1].lo < nonZ);
 
-      groundConnected = (lo < nonZ);
-    }
-
-    // If ground connection was detected before, the condition will remain;
-    // the call below won't clear it even if called with false
-
-    riteg->isGroundConnected(groundConnected);
-
-    priteg = riteg;
+    for (size_t i = index.timeBegin(t); (i < index.timeEnd(t)); i++)
+      index[i].iteg->isGroundConnected(groundConnected);
   }
 
   eGrpOut.clear();
 
-  ElevGrp::iterator egbeg = eGrpIn.begin(), egend = eGrpIn.end(), iteg, piteg;
-  double lo = 0.0, plo = 0.0;
-
-  for (iteg = piteg = egbeg;; iteg++)
-  {
-    if (iteg != egend)
-    {
-      // Get elevation's lo range value
-      //
-      const woml::Elevation &e = iteg->Pv()->elevation();
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-          (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-          (e.bounded() ? itsBoundedLo : e.value());
-
-      lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-    }
-
-    if (iteg != egbeg)
-    {
-      if ((iteg != egend) && iteg->validTime() == piteg->validTime())
-        ;
-      else if ((plo >= nonZ) && (!(piteg->isGroundConnected())))
-      {
-        // Generate below 0 elevation forcing the curve path to go to the ground
-        //
-        eGrpOut.push_back(*piteg);
-
-        std::optional<woml::NumericalValueRangeMeasure> gR(
-            woml::NumericalValueRangeMeasure(woml::NumericalSingleValueMeasure(-1200, "", ""),
-                                             woml::NumericalSingleValueMeasure(-1100, "", "")));
-
-        woml::Elevation gE(gR);
-        std::optional<woml::Elevation> eG(gE);
-
-        eGrpOut.back().elevation(eG);
-        eGrpOut.back().isGenerated(true);
-      }
-    }
-
-    if (iteg == egend)
-      break;
-
-    eGrpOut.push_back(*iteg);
-
-    piteg = iteg;
-    plo = lo;
-  }
-}
-
-// ----------------------------------------------------------------------
-/*!
- * \brief Get smallest group number from overlapping left side elevations.
- *
- */
-// ----------------------------------------------------------------------
-
-unsigned int SvgRenderer::getLeftSideGroupNumber(ElevGrp &eGrp,
-                                                 ElevGrp::iterator &iteg,
-                                                 unsigned int groupNumber,
-                                                 bool mixed)
-{
-  std::reverse_iterator<ElevGrp::iterator> egend(eGrp.begin()), liteg(iteg);
-  Fmi::DateTime vt = iteg->validTime();
-
-  const woml::Elevation &e = iteg->Pv()->elevation();
-  std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-      (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-  const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-      (e.bounded() ? itsBoundedLo : e.value());
-  std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
-      (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
-  const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
-      (e.bounded() ? itsBoundedHi : e.value());
-  double lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-  double hi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
-  double nonZ = axisManager->nonZeroElevation();
-
-  // BRAINSTORM-2212
-  //
-  // Use separate group for invisible elevations to handle the area separately
-  // to label areas which are partially invisible
-
-  if (axisManager->scaledElevation(lo) <= 0) return groupNumber;
-
-  for (; (liteg != egend); liteg++)
+  for (size_t t = 0; (t < index.timeCount()); t++)
   {
-    int dh = (liteg->validTime() - vt).hours();
-
-    if (dh == -1)
-    {
-      const woml::Elevation &e = liteg->Pv()->elevation();
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-          (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-          (e.bounded() ? itsBoundedLo : e.value());
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
-          (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
-          (e.bounded() ? itsBoundedHi : e.value());
-
-      double llo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-      double lhi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
-
-      // 'mixed' controls whether or not ground and nonground elevations are included into same
-      // group.
-
-      if ((lhi < lo) || ((!mixed) && ((lo < nonZ) != (llo < nonZ))))
-        continue;
-      else if (llo > hi)
-        break;
-
-      unsigned int leftGroupNumber = liteg->groupNumber();
-
-      if ((leftGroupNumber > 0) && (leftGroupNumber < groupNumber))
-        groupNumber = leftGroupNumber;
-    }
-    else if (dh != 0)
-      break;
-  }
-
-  return groupNumber;
-}
-
-// ----------------------------------------------------------------------
-/*!
- * \brief Get smallest group number from overlapping right side elevations.
- *
- */
-// ----------------------------------------------------------------------
-
-unsigned int SvgRenderer::getRightSideGroupNumber(ElevGrp &eGrp,
-                                                  ElevGrp::reverse_iterator &itegrev,
-                                                  unsigned int groupNumber,
-                                                  bool mixed)
-{
-  ElevGrp::iterator egend = eGrp.end(), riteg = itegrev.base(), iteg = itegrev.base();
-  Fmi::DateTime vt = itegrev->validTime();
-
-  iteg--;
+    for (size_t i = index.timeBegin(t); (i < index.timeEnd(t)); i++)
+      eGrpOut.push_back(*(index[i].iteg));
 
-  const woml::Elevation &e = iteg->Pv()->elevation();
-  std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-      (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-  const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-      (e.bounded() ? itsBoundedLo : e.value());
-  std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
-      (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
-  const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
-      (e.bounded() ? itsBoundedHi : e.value());
-  double lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-  double hi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
-  double nonZ = axisManager->nonZeroElevation();
-
-  // BRAINSTORM-2212
-  //
-  // Use separate group for invisible elevations to handle the area separately
-  // to label areas which are partially invisible
-
-  if (axisManager->scaledElevation(lo) <= 0) return groupNumber;
+    const ElevationIndex::Range &last = index[index.timeEnd(t) - 1];
 
-  for (; (riteg != egend); riteg++)
-  {
-    int dh = (riteg->validTime() - vt).hours();
-
-    if (dh == 1)
+    if ((last.lo >= nonZ) && (!(last.iteg->isGroundConnected())))
     {
-      const woml::Elevation &e = riteg->Pv()->elevation();
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
-          (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
-          (e.bounded() ? itsBoundedLo : e.value());
-      std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
-          (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
-      const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
-          (e.bounded() ? itsBoundedHi : e.value());
-
-      double rlo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
-      double rhi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
-
-      // 'mixed' controls whether or not ground and nonground elevations are included into same
-      // group.
-
-      if ((rlo > hi) || ((!mixed) && ((lo < nonZ) != (rlo < nonZ))))
-        continue;
-      else if (rhi < lo)
-        break;
+      // Generate below 0 elevation forcing the curve path to go to the ground
+      //
+      eGrpOut.push_back(*(last.iteg));
 
-      unsigned int rightGroupNumber = riteg->groupNumber();
+      std::optional<woml::NumericalValueRangeMeasure> gR(
+          woml::NumericalValueRangeMeasure(woml::NumericalSingleValueMeasure(-1200, "", ""),
+                                           woml::NumericalSingleValueMeasure(-1100, "", "")));
 
-      if ((rightGroupNumber > 0) && (rightGroupNumber < groupNumber))
-        groupNumber = rightGroupNumber;
+      woml::Elevation gE(gR);
+      std::optional<woml::Elevation> eG(gE);
+
+      eGrpOut.back().elevation(eG);
+      eGrpOut.back().isGenerated(true);
     }
-    else if (dh != 0)
-      break;
   }
-
-  return groupNumber;
 }
 
 // ----------------------------------------------------------------------
@@ -9914,55 +10119,123 @@ void SvgRenderer::setGroupNumbers(const std::list<woml::TimeSeriesSlot> &ts, boo
 
   elevationGroup(ts, bt, et, eGrp, true, false);
 
-  unsigned int nextGroupNumber = 1;
-  bool reScan;
+  // Load elevation ranges indexed by time instant
 
-  do
+  ElevationIndex index(eGrp);
+  std::vector<bool> visible(index.size());
+
+  for (size_t i = 0; (i < index.size()); i++)
   {
-    // For each elevation, set minimum group number from overlapping left and right side elevations
-    // (if any).
-    // Repeat until no changes were made.
+    // BRAINSTORM-2212
+    //
+    // Invisible elevations do not take group number from overlapping elevations; they use
+    // separate group to handle the area separately to label areas which are partially invisible
 
-    ElevGrp::iterator egend(eGrp.end()), iteg = eGrp.begin();
-    unsigned int groupNumber, currentGroupNumber;
+    visible[i] = (axisManager->scaledElevation(index[i].lo) > 0);
+  }
 
-    reScan = false;
+  // Collect pairs of overlapping elevations on adjacent time instants, ordered by the elevation
+  // on the later time instant.
+  //
+  // 'mixed' controls whether or not ground and nonground elevations are included into same
+  // group.
+
+  std::vector<std::pair<size_t, size_t>> overlaps;
+  std::vector<size_t> leftRanges;
+  double nonZ = axisManager->nonZeroElevation();
+
+  for (size_t t = 0; (t < index.timeCount()); t++)
+  {
+    std::optional<size_t> leftTime = index.previousTime(t);
+
+    if (!leftTime)
+      continue;
+
+    for (size_t i = index.timeBegin(t); (i < index.timeEnd(t)); i++)
+    {
+      index.overlapping(*leftTime, index[i].lo, index[i].hi, leftRanges);
+
+      for (size_t j : leftRanges)
+        if (mixed || ((index[i].lo < nonZ) == (index[j].lo < nonZ)))
+          overlaps.push_back(std::make_pair(i, j));
+    }
+  }
+
+  // Number the elevations in time order, taking the smallest group number from overlapping
+  // elevations on the left side (if any)
+
+  std::vector<std::pair<size_t, size_t>>::const_iterator itov = overlaps.begin();
+  unsigned int nextGroupNumber = 1;
 
-    // Set smallest group number from overlapping elevations on the left side (if any)
+  for (size_t i = 0; (i < index.size()); i++)
+  {
+    unsigned int currentGroupNumber = index[i].iteg->groupNumber();
+    unsigned int groupNumber = ((currentGroupNumber == 0) ? nextGroupNumber : currentGroupNumber);
 
-    for (; (iteg != egend); iteg++)
+    for (; ((itov != overlaps.end()) && (itov->first == i)); itov++)
     {
-      currentGroupNumber = iteg->groupNumber();
+      unsigned int leftGroupNumber = index[itov->second].iteg->groupNumber();
 
-      groupNumber = getLeftSideGroupNumber(
-          eGrp, iteg, ((currentGroupNumber == 0) ? nextGroupNumber : currentGroupNumber), mixed);
+      if (visible[i] && (leftGroupNumber > 0) && (leftGroupNumber < groupNumber))
+        groupNumber = leftGroupNumber;
+    }
 
-      if ((currentGroupNumber == 0) || (groupNumber < currentGroupNumber))
-      {
-        iteg->groupNumber(groupNumber);
-        reScan = true;
+    if ((currentGroupNumber == 0) || (groupNumber < currentGroupNumber))
+    {
+      index[i].iteg->groupNumber(groupNumber);
 
-        if (groupNumber == nextGroupNumber)
-          nextGroupNumber++;
-      }
+      if (groupNumber == nextGroupNumber)
+        nextGroupNumber++;
     }
+  }
+
+  // Join overlapping visible elevations using union-find. Each joined group gets the smallest
+  // group number of its members and of the invisible elevations they overlap
+
+  std::vector<size_t> parent(index.size());
+  std::vector<unsigned int> groupNumbers(index.size());
+
+  for (size_t i = 0; (i < index.size()); i++)
+  {
+    parent[i] = i;
+    groupNumbers[i] = index[i].iteg->groupNumber();
+  }
 
-    // Get smallest group number from overlapping elevations on the right side (if any)
+  auto root = [&parent](size_t i)
+  {
+    while (parent[i] != i)
+      i = parent[i] = parent[parent[i]];
 
-    ElevGrp::reverse_iterator regend(eGrp.begin()), riteg(eGrp.end());
+    return i;
+  };
 
-    for (riteg++; (riteg != regend); riteg++)
+  for (const auto &overlap : overlaps)
+    if (visible[overlap.first] && visible[overlap.second])
     {
-      groupNumber =
-          getRightSideGroupNumber(eGrp, riteg, currentGroupNumber = riteg->groupNumber(), mixed);
+      size_t r1 = root(overlap.first), r2 = root(overlap.second);
 
-      if (groupNumber < currentGroupNumber)
+      if (r1 != r2)
       {
-        riteg->groupNumber(groupNumber);
-        reScan = true;
+        parent[std::max(r1, r2)] = std::min(r1, r2);
+        groupNumbers[std::min(r1, r2)] = std::min(groupNumbers[r1], groupNumbers[r2]);
       }
     }
-  } while (reScan);
+
+  for (const auto &overlap : overlaps)
+  {
+    if (visible[overlap.first] == visible[overlap.second])
+      continue;
+
+    size_t visibleElev = (visible[overlap.first] ? overlap.first : overlap.second);
+    size_t invisibleElev = (visible[overlap.first] ? overlap.second : overlap.first);
+    unsigned int &groupNumber = groupNumbers[root(visibleElev)];
+
+    groupNumber = std::min(groupNumber, index[invisibleElev].iteg->groupNumber());
+  }
+
+  for (size_t i = 0; (i < index.size()); i++)
+    if (visible[i] && (groupNumbers[root(i)] < index[i].iteg->groupNumber()))
+      index[i].iteg->groupNumber(groupNumbers[root(i)]);
 }
 
 // ----------------------------------------------------------------------
@@ -10118,16 +10391,19 @@ void SvgRenderer::render_timeserie(const woml::ZeroTolerance &zerotolerance)
     int nGroups = 0;
 
     std::vector<DirectPosition> curvePositions;
-    std::list<DirectPosition> curvePoints;
+    std::vector<DirectPosition> curvePoints;
 
-    // Set unique group number for members of each overlapping group of elevations
-
-    setGroupNumbers(ts);
-
-    // Search and flag elevation holes
+    // Set unique group number for members of each overlapping group of elevations,
+    // and search and flag elevation holes unless already done
 
     NFmiFillAreas holeAreas;
-    bool hasHole = searchHoles(ts);
+    bool hasHole;
+
+    if (!preparedTimeserie(ts, hasHole))
+    {
+      setGroupNumbers(ts);
+      hasHole = searchHoles(ts);
+    }
 
     Fmi::DateTime bt, et;
 
@@ -10214,14 +10490,14 @@ void SvgRenderer::render_timeserie(const woml::ZeroTolerance &zerotolerance)
       // y=%.1f\n",itcp->getX(),itcp->getY());
       //}
       BezierModel bm(curvePositions, true, tightness);
-      bm.getSteppedCurvePoints(10, 0, 0, curvePoints);
+      bm.getSteppedCurvePoints(10, 0, 0, curvePoints, randomGenerator);
 
       // Output the path
 
       path.clear();
       path.str("");
-      std::list<DirectPosition>::iterator cpbeg = curvePoints.begin(), cpend = curvePoints.end(),
-                                          itcp;
+      std::vector<DirectPosition>::iterator cpbeg = curvePoints.begin(),
+                                            cpend = curvePoints.end(), itcp;
 
       // fprintf(stderr,"> Bez:\n");
       // for (itcp = cpbeg; (itcp != cpend); itcp++) fprintf(stderr,"> Bez x=%.1f,
@@ -10324,194 +10600,464 @@ void SvgRenderer::render_value(const std::string &confPath,
 
   try
   {
-    const char *typeMsg = " must contain a list of groups in parenthesis";
     const char *valtypeMsg = ": type must be 'value' or 'svg'";
 
-    const libconfig::Setting &valSpecs = config.lookup(confPath);
-    if (!valSpecs.isList())
-      throw std::runtime_error(confPath + typeMsg);
+    const ConfigBlocks *valBlocks = configResolver.blocks(confPath);
 
-    settings s_name((settings)(s_base + 0));
+    if (!valBlocks)
+    {
+      // No settings for confPath
+      //
+      if (options.debug)
+        debugoutput << "Settings for " << confPath << " (" << valClass << ") not found\n";
+
+      return;
+    }
 
     int valIdx = -1;
     int globalsIdx = -1;
 
-    for (int i = 0; i < valSpecs.getLength(); ++i)
+    for (int i = 0; i < (int)valBlocks->size(); ++i)
     {
-      const libconfig::Setting &specs = valSpecs[i];
-      if (!specs.isGroup())
-        throw std::runtime_error(confPath + typeMsg);
+      const ConfigBlock &block = (*valBlocks)[i];
+      const libconfig::Setting &specs = *(block.specs);
 
-      try
+      if (!block.hasName)
       {
-        if (lookup<std::string>(specs, confPath, "name", s_name) == valClass)
-        {
-          valIdx = i;
+        // Global settings have no name
+        //
+        globalsIdx = i;
+        continue;
+      }
+
+      if (block.name == valClass)
+      {
+        valIdx = i;
 
-          // Missing settings from globals when available
-          libconfig::Setting *globalScope = ((globalsIdx >= 0) ? &valSpecs[globalsIdx] : nullptr);
+        // Missing settings from globals when available
+        const libconfig::Setting *globalScope =
+            ((globalsIdx >= 0) ? (*valBlocks)[globalsIdx].specs : nullptr);
 
-          // Value type; value (the default) or svg.
+        // Value type; value (the default) or svg.
+        //
+        // Note: When rendering (wind symbol with) wind speed asValue is true; block's 'type'
+        // setting
+        // (for the symbol; svg) is ignored
+        std::string type = (asValue ? "value"
+                                    : configValue<std::string>(
+                                          specs, valClass, "type", globalScope, s_optional));
+
+        if (type.empty() || (type == "value"))
+        {
+          // Class, format and reference for background class
           //
-          // Note: When rendering (wind symbol with) wind speed asValue is true; block's 'type'
-          // setting
-          // (for the symbol; svg) is ignored
-          std::string type = (asValue ? "value"
-                                      : configValue<std::string>(
-                                            specs, valClass, "type", globalScope, s_optional));
-
-          if (type.empty() || (type == "value"))
+          std::string vtype(upperLimit ? "Range" : "");
+
+          std::string classDef(configValue<std::string>(
+              specs, valClass, "class" + vtype, globalScope, s_optional));
+          if (classDef.empty())
+            classDef = (vtype.empty() ? valClass : (valClass + " " + valClass + vtype));
+
+          std::string pref(
+              configValue<std::string>(specs, valClass, "pref" + vtype, globalScope, s_optional));
+          std::string href(
+              configValue<std::string>(specs, valClass, "href" + vtype, globalScope, s_optional));
+
+          // Output placeholder; by default output to passed stream
+
+          std::string placeHolder(boost::algorithm::trim_copy(
+              configValue<std::string>(specs, valClass, "output", globalScope, s_optional)));
+
+          // Offsets for placing the value (used for wind speed to position the value to the
+          // center or to the border
+          // of the wind symbol)
+
+          int xoffset = 0, yoffset = 0;
+          bool isSet;
+
+          if (asValue)
           {
-            // Class, format and reference for background class
-            //
-            std::string vtype(upperLimit ? "Range" : "");
+            xoffset = static_cast<int>(floor(configValue<float, int>(
+                specs, valClass, "vxoffset", globalScope, s_optional, &isSet)));
+            if (!isSet)
+              xoffset = 0;
+
+            yoffset = static_cast<int>(floor(configValue<float, int>(
+                specs, valClass, "vyoffset", globalScope, s_optional, &isSet)));
+            if (!isSet)
+              yoffset = 0;
+          }
 
-            std::string classDef(configValue<std::string>(
-                specs, valClass, "class" + vtype, globalScope, s_optional));
-            if (classDef.empty())
-              classDef = (vtype.empty() ? valClass : (valClass + " " + valClass + vtype));
+          // For single value, search for matching condition with nearest comparison value
 
-            std::string pref(
-                configValue<std::string>(specs, valClass, "pref" + vtype, globalScope, s_optional));
-            std::string href(
-                configValue<std::string>(specs, valClass, "href" + vtype, globalScope, s_optional));
+          const libconfig::Setting *condSpecs =
+              (!upperLimit) ? matchingCondition(configResolver,
+                                                confPath,
+                                                valClass,
+                                                "",
+                                                i,
+                                                lowerLimit->numericValue())
+                            : nullptr;
 
-            // Output placeholder; by default output to passed stream
+          if (condSpecs)
+          {
+            // Class from the condition or from the parent/parameter block
+            //
+            classDef = configValue<std::string>(*condSpecs, valClass, "class", &specs);
 
-            std::string placeHolder(boost::algorithm::trim_copy(
-                configValue<std::string>(specs, valClass, "output", globalScope, s_optional)));
+            std::string cpref = configValue<std::string>(
+                *condSpecs, valClass, "pref" + vtype, nullptr, s_optional, &isSet);
+            if (isSet)
+              pref = cpref;
 
-            // Offsets for placing the value (used for wind speed to position the value to the
-            // center or to the border
-            // of the wind symbol)
+            std::string chref = configValue<std::string>(
+                *condSpecs, valClass, "href" + vtype, nullptr, s_optional, &isSet);
+            if (isSet)
+              href = chref;
 
-            int xoffset = 0, yoffset = 0;
-            bool isSet;
+            std::string ph = configValue<std::string>(
+                *condSpecs, valClass, "output", nullptr, s_optional, &isSet);
+            if (isSet)
+              placeHolder = ph;
 
             if (asValue)
             {
-              xoffset = static_cast<int>(floor(configValue<float, int>(
-                  specs, valClass, "vxoffset", globalScope, s_optional, &isSet)));
-              if (!isSet)
-                xoffset = 0;
-
-              yoffset = static_cast<int>(floor(configValue<float, int>(
-                  specs, valClass, "vyoffset", globalScope, s_optional, &isSet)));
-              if (!isSet)
-                yoffset = 0;
+              int cxoffset = 0, cyoffset = 0;
+
+              cxoffset = static_cast<int>(floor(configValue<float, int>(
+                  *condSpecs, valClass, "vxoffset", nullptr, s_optional, &isSet)));
+              if (isSet)
+                xoffset = cxoffset;
+
+              cyoffset = static_cast<int>(floor(configValue<float, int>(
+                  *condSpecs, valClass, "vyoffset", nullptr, s_optional, &isSet)));
+              if (isSet)
+                yoffset = cyoffset;
             }
+          }
 
-            // For single value, search for matching condition with nearest comparison value
+          // Wind speed is not rendered if format is empty (used to supress zero values)
 
-            const libconfig::Setting *condSpecs =
-                (!upperLimit) ? matchingCondition(
-                                    config, confPath, valClass, "", i, lowerLimit->numericValue())
-                              : nullptr;
+          if (asValue && pref.empty())
+            return;
 
-            if (condSpecs)
-            {
-              // Class from the condition or from the parent/parameter block
-              //
-              classDef = configValue<std::string>(*condSpecs, valClass, "class", &specs);
+          lon -= xoffset;
+          lat += yoffset;
 
-              std::string cpref = configValue<std::string>(
-                  *condSpecs, valClass, "pref" + vtype, nullptr, s_optional, &isSet);
-              if (isSet)
-                pref = cpref;
+          std::ostringstream &values = (placeHolder.empty() ? valOutput : texts[placeHolder]);
 
-              std::string chref = configValue<std::string>(
-                  *condSpecs, valClass, "href" + vtype, nullptr, s_optional, &isSet);
-              if (isSet)
-                href = chref;
+          values << "<g class=\"" << classDef << "\">\n";
 
-              std::string ph = configValue<std::string>(
-                  *condSpecs, valClass, "output", nullptr, s_optional, &isSet);
-              if (isSet)
-                placeHolder = ph;
+          if (href.empty())
+            values << "<text id=\"text" << Fmi::to_string(npointvalues)
+                   << "\" text-anchor=\"middle\" x=\"" << std::fixed << std::setprecision(1)
+                   << lon << "\" y=\"" << std::fixed << std::setprecision(1) << lat << "\">"
+                   << formattedValue(
+                          lowerLimit, upperLimit, confPath, pref, nullptr, &specs, globalScope)
+                   << "</text>\n";
+          else
+            values << "<g transform=\"translate(" << std::fixed << std::setprecision(1) << lon
+                   << " " << std::fixed << std::setprecision(1) << lat << ")\">\n"
+                   << "<use xlink:href=\"#" << href << "\"/>\n"
+                   << "<text id=\"text" << Fmi::to_string(npointvalues)
+                   << "\" text-anchor=\"middle\">"
+                   << formattedValue(
+                          lowerLimit, upperLimit, confPath, pref, nullptr, &specs, globalScope)
+                   << "</text>\n"
+                   << "</g>\n";
+
+          values << "</g>\n";
 
-              if (asValue)
-              {
-                int cxoffset = 0, cyoffset = 0;
+          return;
+        }
+        else if (type == "svg")
+        {
+          throw std::runtime_error(confPath + " type 'svg' not implemented yet");
+        }
+        else
+          throw std::runtime_error(confPath + ": '" + type + "'" + valtypeMsg);
+      }
+    }  // for
 
-                cxoffset = static_cast<int>(floor(configValue<float, int>(
-                    *condSpecs, valClass, "vxoffset", nullptr, s_optional, &isSet)));
-                if (isSet)
-                  xoffset = cxoffset;
+    if (options.debug)
+    {
+      // No (locale) settings for the value
+      //
+      const char *p = ((valIdx < 0) ? "Settings for " : "Locale specific settings for ");
 
-                cyoffset = static_cast<int>(floor(configValue<float, int>(
-                    *condSpecs, valClass, "vyoffset", nullptr, s_optional, &isSet)));
-                if (isSet)
-                  yoffset = cyoffset;
-              }
-            }
+      debugoutput << p << valClass << " not found\n";
+    }
+  }
+  catch (libconfig::SettingNotFoundException &ex)
+  {
+    // No settings for confPath
+    //
+    if (options.debug)
+      debugoutput << "Settings for " << confPath << " (" << valClass << ") not found\n";
+  }
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Configuration resolver constructor
+ */
+// ----------------------------------------------------------------------
+
+ConfigResolver::ConfigResolver(const libconfig::Config &theConfig, const std::string &theLocale)
+    : itsConfig(theConfig), itsLocale(theLocale)
+{
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get configuration blocks for given list type setting.
+ *
+ *		The blocks are loaded when first requested; block names and locales
+ *		are looked up only once, so searching for the block(s) to use does
+ *		not need to catch exceptions for the global (unnamed) blocks.
+ *		Returns nullptr if the setting does not exist.
+ */
+// ----------------------------------------------------------------------
+
+const ConfigBlocks *ConfigResolver::blocks(const std::string &theConfPath)
+{
+  auto iter = itsBlocks.find(theConfPath);
+
+  if (iter != itsBlocks.end())
+    return (iter->second ? &(*(iter->second)) : nullptr);
 
-            // Wind speed is not rendered if format is empty (used to supress zero values)
+  if (!itsConfig.exists(theConfPath))
+  {
+    itsBlocks.insert(std::make_pair(theConfPath, std::optional<ConfigBlocks>()));
+    return nullptr;
+  }
+
+  const char *typeMsg = " must contain a list of groups in parenthesis";
+
+  const libconfig::Setting &specs = itsConfig.lookup(theConfPath);
+  if (!specs.isList())
+    throw std::runtime_error(theConfPath + typeMsg);
 
-            if (asValue && pref.empty())
-              return;
+  settings s_name((settings)(s_base + 0));
 
-            lon -= xoffset;
-            lat += yoffset;
+  ConfigBlocks configBlocks;
+  configBlocks.reserve(specs.getLength());
 
-            std::ostringstream &values = (placeHolder.empty() ? valOutput : texts[placeHolder]);
+  for (int i = 0; i < specs.getLength(); ++i)
+  {
+    const libconfig::Setting &blockSpecs = specs[i];
+    if (!blockSpecs.isGroup())
+      throw std::runtime_error(theConfPath + typeMsg);
 
-            values << "<g class=\"" << classDef << "\">\n";
+    ConfigBlock block;
+    block.specs = &blockSpecs;
 
-            if (href.empty())
-              values << "<text id=\"text" << Fmi::to_string(npointvalues)
-                     << "\" text-anchor=\"middle\" x=\"" << std::fixed << std::setprecision(1)
-                     << lon << "\" y=\"" << std::fixed << std::setprecision(1) << lat << "\">"
-                     << formattedValue(
-                            lowerLimit, upperLimit, confPath, pref, nullptr, &specs, globalScope)
-                     << "</text>\n";
-            else
-              values << "<g transform=\"translate(" << std::fixed << std::setprecision(1) << lon
-                     << " " << std::fixed << std::setprecision(1) << lat << ")\">\n"
-                     << "<use xlink:href=\"#" << href << "\"/>\n"
-                     << "<text id=\"text" << Fmi::to_string(npointvalues)
-                     << "\" text-anchor=\"middle\">"
-                     << formattedValue(
-                            lowerLimit, upperLimit, confPath, pref, nullptr, &specs, globalScope)
-                     << "</text>\n"
-                     << "</g>\n";
-
-            values << "</g>\n";
+    try
+    {
+      block.name = lookup<std::string>(blockSpecs, theConfPath, "name", s_name);
+      block.hasName = true;
+    }
+    catch (SettingIdNotFoundException &ex)
+    {
+      // Global settings have no name
+      //
+      block.hasName = false;
+    }
+
+    block.locale = toLower(configValue<std::string>(
+        blockSpecs, block.hasName ? block.name : theConfPath, "locale", nullptr, s_optional));
+
+    configBlocks.push_back(block);
+  }
+
+  return &(*(itsBlocks[theConfPath] = std::move(configBlocks)));
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get active scope for given list type setting and block name.
+ *
+ *		The scope contains the global blocks (blocks with no name) and the
+ *		first block with matching name in the order of appearance, the
+ *		current block being the last element. If there is no block with
+ *		matching name, the scope contains the global blocks only.
+ *
+ *		If 'localeBlocks' is set, only blocks with no locale or with matching
+ *		locale are used.
+ *
+ *		Returns nullptr if the setting does not exist.
+ */
+// ----------------------------------------------------------------------
+
+const ConfigScope *ConfigResolver::scope(const std::string &theConfPath,
+                                         const std::string &theName,
+                                         bool localeBlocks)
+{
+  std::string key(theConfPath + "\n" + theName + (localeBlocks ? "\n" : ""));
+  auto iter = itsScopes.find(key);
+
+  if (iter != itsScopes.end())
+    return &(iter->second);
+
+  const ConfigBlocks *configBlocks = blocks(theConfPath);
+
+  if (!configBlocks)
+    return nullptr;
+
+  ConfigScope configScope;
+  configScope.nameIdx = -1;
+
+  for (size_t i = 0; i < configBlocks->size(); ++i)
+  {
+    const ConfigBlock &block = (*configBlocks)[i];
+    bool localeMatch =
+        ((!localeBlocks) || block.locale.empty() || (block.locale == itsLocale));
+
+    if (block.hasName)
+    {
+      if (block.name != theName)
+        continue;
+
+      configScope.nameIdx = i;
+
+      if (localeMatch)
+      {
+        configScope.scope.push_back(block.specs);
+        break;
+      }
+    }
+    else if (localeMatch)
+      configScope.scope.push_back(block.specs);
+  }
+
+  return &(itsScopes[key] = configScope);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get the condition table for given path and block index.
+ *
+ *		The table is built on first use and compiled lazily by the type of
+ *		the matched value.
+ *
+ *		Returns nullptr if the conditions do not exist.
+ */
+// ----------------------------------------------------------------------
+
+ConditionTable *ConfigResolver::conditions(const std::string &theConfPath,
+                                           const std::string &theClassName,
+                                           int theSpecsIdx)
+{
+  std::string condPath(theConfPath +
+                       ((theSpecsIdx >= 0) ? (".[" + Fmi::to_string(theSpecsIdx) + "]") : "") +
+                       ".conditions");
+  auto iter = itsConditions.find(condPath);
+
+  if (iter != itsConditions.end())
+    return iter->second.get();
+
+  std::shared_ptr<ConditionTable> &conditions = itsConditions[condPath];
+
+  if (itsConfig.exists(condPath))
+    conditions.reset(new ConditionTable(itsConfig.lookup(condPath), theConfPath, theClassName));
+
+  return conditions.get();
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Parse the class selectors' properties from the template's CSS
+ *
+ *		Only plain class selectors (.class) are stored. The first rule of a
+ *		class is used; properties of later rules for the class are ignored.
+ */
+// ----------------------------------------------------------------------
+
+CssClasses parseCssClasses(const std::string &theTemplate)
+{
+  CssClasses cssClasses;
+  std::string::size_type pos = 0;
+
+  while ((pos = theTemplate.find("<style", pos)) != std::string::npos)
+  {
+    std::string::size_type pos1 = theTemplate.find(">", pos);
+    std::string::size_type pos2 = theTemplate.find("</style>", pos);
+
+    if ((pos1 == std::string::npos) || (pos2 == std::string::npos) || (pos1 > pos2))
+      break;
+
+    std::string css = theTemplate.substr(pos1 + 1, pos2 - pos1 - 1);
+    pos = pos2;
+
+    // Remove CDATA markers and comments
+
+    boost::algorithm::replace_all(css, "<![CDATA[", "");
+    boost::algorithm::replace_all(css, "]]>", "");
+
+    for (pos1 = css.find("/*"); (pos1 != std::string::npos); pos1 = css.find("/*", pos1))
+    {
+      pos2 = css.find("*/", pos1 + 2);
+      css.erase(pos1, (pos2 == std::string::npos) ? pos2 : (pos2 + 2 - pos1));
+    }
+
+    // Rules; selectors { property: value; ... }
+
+    for (pos1 = 0; ((pos2 = css.find("{", pos1)) != std::string::npos);)
+    {
+      std::string::size_type pos3 = css.find("}", pos2);
+      if (pos3 == std::string::npos)
+        break;
+
+      std::vector<std::string> selectors;
+      std::vector<std::string> declarations;
+      std::string selectorList = css.substr(pos1, pos2 - pos1);
+      std::string declarationList = css.substr(pos2 + 1, pos3 - pos2 - 1);
+
+      boost::split(selectors, selectorList, boost::is_any_of(","));
+      boost::split(declarations, declarationList, boost::is_any_of(";"));
+
+      pos1 = pos3 + 1;
+
+      for (auto &selector : selectors)
+      {
+        boost::algorithm::trim(selector);
+
+        if ((selector.size() < 2) || (selector[0] != '.') ||
+            (selector.find_first_of(" \t\r\n.:#>+~[", 1) != std::string::npos))
+          continue;
+
+        auto cssClass = cssClasses.emplace(selector.substr(1), CssClasses::mapped_type());
+        if (!cssClass.second)
+          continue;
+
+        auto &properties = cssClass.first->second;
+
+        for (auto const &declaration : declarations)
+        {
+          std::string::size_type pos4 = declaration.find(":");
+          if (pos4 == std::string::npos)
+            continue;
+
+          std::string property = boost::algorithm::trim_copy(declaration.substr(0, pos4));
+          std::string value = boost::algorithm::trim_copy(declaration.substr(pos4 + 1));
+          std::optional<double> pixels;
+
+          if ((value.size() > 2) && (value.substr(value.size() - 2, 2) == "px"))
+            try
+            {
+              pixels = std::stod(value.substr(0, value.size() - 2));
+            }
+            catch (std::exception &)
+            {
+            }
 
-            return;
-          }
-          else if (type == "svg")
-          {
-            throw std::runtime_error(confPath + " type 'svg' not implemented yet");
-          }
-          else
-            throw std::runtime_error(confPath + ": '" + type + "'" + valtypeMsg);
+          properties.emplace(property, pixels);
         }
       }
-      catch (SettingIdNotFoundException &ex)
-      {
-        if (ex.id() == s_name)
-          // Global settings have no name
-          //
-          globalsIdx = i;
-      }
-    }  // for
-
-    if (options.debug)
-    {
-      // No (locale) settings for the value
-      //
-      const char *p = ((valIdx < 0) ? "Settings for " : "Locale specific settings for ");
-
-      debugoutput << p << valClass << " not found\n";
     }
   }
-  catch (libconfig::SettingNotFoundException &ex)
-  {
-    // No settings for confPath
-    //
-    if (options.debug)
-      debugoutput << "Settings for " << confPath << " (" << valClass << ") not found\n";
-  }
+
+  return cssClasses;
 }
 
 // ----------------------------------------------------------------------
@@ -10532,6 +11078,12 @@ SvgRenderer::SvgRenderer(const Options &theOptions,
       area(theArea),
       validtime(theValidTime),
       initAerodrome(true),
+      aerodromeFeatures(),
+      preparedTimeseries(),
+      randomGenerator(theOptions.seed),
+      windArrowSymbols(),
+      configResolver(theConfig, theOptions.locale),
+      cssClasses(parseCssClasses(theTemplate)),
       debugoutput(theDebugOutput ? *theDebugOutput : _debugoutput),
       ncloudareas(0),
       ncoldfronts(0),
@@ -10543,8 +11095,56 @@ SvgRenderer::SvgRenderer(const Options &theOptions,
       nprecipitationareas(0),
       ntroughs(0),
       nuppertroughs(0),
-      nwarmfronts(0)
+      nwarmfronts(0),
+      nculled(0)
 {
+  // Path data encoding; absolute (default) or compact (relative commands, trimmed numbers).
+  // Path precision (number of decimals) defaults to 1 for surfaces, contours and fronts and
+  // to 3 for cloud layers; precision 0 rounds to integer pixels
+
+  const libconfig::Setting &root = config.getRoot();
+  std::string encoding = lookup<std::string>(root, "", "pathencoding", s_optional);
+
+  if (encoding == "compact")
+    coordinateWriter.encoding(CoordinateWriter::Compact);
+  else if ((!encoding.empty()) && (encoding != "absolute"))
+    throw std::runtime_error("pathencoding must be \"absolute\" or \"compact\"");
+
+  bool isSet;
+  int precision = lookup<int>(root, "", "pathprecision", s_optional, &isSet);
+
+  if (isSet)
+  {
+    if ((precision < 0) || (precision > 6))
+      throw std::runtime_error("pathprecision must be between 0 and 6");
+
+    pathPrecision = precision;
+  }
+
+  // Clipping of surfaces, fronts and contours to the chart area; disabled unless the margin
+  // (in pixels) is given
+
+  double margin = configValue<double, int>(root, "", "clipmargin", nullptr, s_optional, &isSet);
+
+  if (isSet)
+  {
+    if (margin < 0)
+      throw std::runtime_error("clipmargin must be nonnegative");
+
+    clipMargin = margin;
+  }
+
+  // Skipping of features outside the chart area; disabled unless the margin (in pixels) is given
+
+  margin = configValue<double, int>(root, "", "cullmargin", nullptr, s_optional, &isSet);
+
+  if (isSet)
+  {
+    if (margin < 0)
+      throw std::runtime_error("cullmargin must be nonnegative");
+
+    cullMargin = margin;
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -10667,7 +11267,10 @@ std::string SvgRenderer::svg() const
   // for does not work nicely with ptr_map
 
   if (options.verbose)
+  {
+    std::cerr << "Skipped " << nculled << " features outside the area" << std::endl;
     std::cerr << "Generating " << contours.size() << " contours" << std::endl;
+  }
 
   for (Contours::const_iterator it = contours.begin(); it != contours.end(); ++it)
     replace_all(ret, it->first, it->second->str());
@@ -10734,7 +11337,8 @@ AxisManager::AxisManager(const libconfig::Config &config)
       itsUtc(false),
       itsTimePeriod(Fmi::DateTime(Fmi::DateTime::NOT_A_DATE_TIME),
                     Fmi::DateTime(Fmi::DateTime::NOT_A_DATE_TIME)),
-      itsElevations()
+      itsElevations(),
+      itsElevationScale()
 {
   std::string confPath("ElevationAxis");
 
@@ -10826,6 +11430,11 @@ AxisManager::AxisManager(const libconfig::Config &config)
             fmt::format("%.3f", it->scale()) + scaleMsg);
       else
         it2->factor((it->scale() - it2->scale()) / (it->elevation() - it2->elevation()));
+
+    // Store the breakpoints contiguously for scaling
+
+    for (const Elevation &elevation : itsElevations)
+      itsElevationScale.add(elevation.elevation(), elevation.scale());
   }
   catch (libconfig::ConfigException &ex)
   {
@@ -10847,7 +11456,7 @@ AxisManager::AxisManager(const libconfig::Config &config)
 double AxisManager::scaledElevation(double elevation,
                                     bool *above,
                                     double belowZero,
-                                    double aboveTop)
+                                    double aboveTop) const
 {
   // Find lo/hi limits for linear interpolation
   //
@@ -10868,22 +11477,7 @@ double AxisManager::scaledElevation(double elevation,
     return -aboveTop;
   }
 
-  std::list<Elevation>::iterator ith =
-      lower_bound(itsElevations.begin(), itsElevations.end(), Elevation(elevation));
-  if (ith == itsElevations.end())
-    // Never
-    return 0;
-
-  if (ith->elevation() > elevation)
-  {
-    std::list<Elevation>::iterator itl = ith;
-    itl--;
-
-    return itsAxisHeight -
-           (itsAxisHeight * (itl->scale() + ((elevation - itl->elevation()) * itl->factor())));
-  }
-
-  return itsAxisHeight - (itsAxisHeight * ith->scale());
+  return itsAxisHeight - (itsAxisHeight * itsElevationScale.scale(elevation));
 }
 
 // ----------------------------------------------------------------------
@@ -10917,6 +11511,102 @@ double AxisManager::xStep() const
   return ((nH > 0) ? (itsAxisWidth / nH) : 0);
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief ElevationIndex
+ */
+// ----------------------------------------------------------------------
+
+ElevationIndex::ElevationIndex(ElevGrp &eGrp) : itsRanges(), itsTimes(), itsLoOrder()
+{
+  itsRanges.reserve(eGrp.size());
+  itsLoOrder.reserve(eGrp.size());
+
+  for (ElevGrp::iterator iteg = eGrp.begin(); (iteg != eGrp.end()); iteg++)
+  {
+    const woml::Elevation &e = iteg->elevation();
+    std::optional<woml::NumericalSingleValueMeasure> itsBoundedLo =
+        (e.bounded() ? e.lowerLimit() : woml::NumericalSingleValueMeasure());
+    const std::optional<woml::NumericalSingleValueMeasure> &itsLoLimit =
+        (e.bounded() ? itsBoundedLo : e.value());
+    std::optional<woml::NumericalSingleValueMeasure> itsBoundedHi =
+        (e.bounded() ? e.upperLimit() : woml::NumericalSingleValueMeasure());
+    const std::optional<woml::NumericalSingleValueMeasure> &itsHiLimit =
+        (e.bounded() ? itsBoundedHi : e.value());
+    double lo = ((!itsLoLimit) ? 0.0 : itsLoLimit->numericValue());
+    double hi = ((!itsHiLimit) ? 0.0 : itsHiLimit->numericValue());
+
+    if (itsRanges.empty() || (iteg->validTime() != itsRanges.back().iteg->validTime()))
+      itsTimes.push_back(itsRanges.size());
+
+    itsLoOrder.push_back(itsRanges.size());
+    itsRanges.push_back(Range{iteg, lo, hi});
+  }
+
+  itsTimes.push_back(itsRanges.size());
+
+  for (size_t t = 0; (t < timeCount()); t++)
+    std::stable_sort(itsLoOrder.begin() + timeBegin(t),
+                     itsLoOrder.begin() + timeEnd(t),
+                     [this](size_t r1, size_t r2) { return itsRanges[r1].lo < itsRanges[r2].lo; });
+}
+
+const Fmi::DateTime &ElevationIndex::validTime(size_t theTime) const
+{
+  return itsRanges[itsTimes[theTime]].iteg->validTime();
+}
+
+size_t ElevationIndex::timeIndex(const Fmi::DateTime &theValidTime) const
+{
+  std::vector<size_t>::const_iterator time = std::lower_bound(
+      itsTimes.begin(),
+      itsTimes.end() - 1,
+      theValidTime,
+      [this](size_t range, const Fmi::DateTime &vt)
+      { return itsRanges[range].iteg->validTime() < vt; });
+
+  return (time - itsTimes.begin());
+}
+
+std::optional<size_t> ElevationIndex::previousTime(size_t theTime) const
+{
+  if ((theTime > 0) && ((validTime(theTime - 1) - validTime(theTime)).hours() == -1))
+    return theTime - 1;
+
+  return std::nullopt;
+}
+
+std::optional<size_t> ElevationIndex::nextTime(size_t theTime) const
+{
+  if ((theTime + 1 < timeCount()) && ((validTime(theTime + 1) - validTime(theTime)).hours() == 1))
+    return theTime + 1;
+
+  return std::nullopt;
+}
+
+void ElevationIndex::overlapping(size_t theTime,
+                                 double lo,
+                                 double hi,
+                                 std::vector<size_t> &theRanges) const
+{
+  // Ranges starting above 'hi' are excluded by binary search
+
+  std::vector<size_t>::const_iterator begin = itsLoOrder.begin() + timeBegin(theTime);
+  std::vector<size_t>::const_iterator end = std::upper_bound(
+      begin,
+      itsLoOrder.begin() + timeEnd(theTime),
+      hi,
+      [this](double value, size_t range) { return value < itsRanges[range].lo; });
+
+  theRanges.clear();
+
+  for (; (begin != end); begin++)
+    if (itsRanges[*begin].hi >= lo)
+      theRanges.push_back(*begin);
+
+  std::sort(theRanges.begin(), theRanges.end());
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief ElevationGroupItem
@@ -11217,6 +11907,25 @@ bool ConfigGroup::contains(const std::string &theMemberType, bool only) const
     return (itsMemberTypes.find("," + theMemberType + ",") != std::string::npos);
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Get the member types of the group
+ */
+// ----------------------------------------------------------------------
+
+std::vector<std::string> ConfigGroup::types() const
+{
+  if (itsStandalone)
+    return std::vector<std::string>(1, itsMemberTypes);
+
+  std::vector<std::string> types;
+  boost::algorithm::split(types, itsMemberTypes, boost::is_any_of(","));
+
+  types.erase(std::remove(types.begin(), types.end(), std::string()), types.end());
+
+  return types;
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Add a member type the group contains
@@ -11355,6 +12064,9 @@ void SvgRenderer::visit(const woml::CloudArea &theFeature)
 
   const woml::CubicSplineSurface surface = theFeature.controlSurface();
 
+  if (outsideArea(controlBBox(*area, surface)))
+    return;
+
   Path path = PathFactory::create(surface);
 
   PathProjector proj(area);
@@ -11396,10 +12108,15 @@ void SvgRenderer::visit(const woml::ColdAdvection &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("coldadvection", "simplify", 0.0));
 
   double fontsize = getCssSize("coldadvectionglyph", "font-size");
   double spacing = getSetting<double>("coldadvection", "letter-spacing", 60.0);
@@ -11407,6 +12124,7 @@ void SvgRenderer::visit(const woml::ColdAdvection &theFeature)
   const char *Cc = ((theFeature.orientation() == "-") ? "C" : "c");
 
   render_front(path,
+               svgPath(path),
                paths,
                coldfronts,
                id,
@@ -11437,18 +12155,32 @@ void SvgRenderer::visit(const woml::ColdFront &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("coldfront", "simplify", 0.0));
 
   double fontsize = getCssSize("coldfrontglyph", "font-size");
   double spacing = getSetting<double>("coldfront", "letter-spacing", 60.0);
 
   const char *Cc = ((theFeature.orientation() == "-") ? "C" : "c");
 
-  render_front(
-      path, paths, coldfronts, id, "coldfront", "coldfrontglyph", Cc, Cc, fontsize, spacing);
+  render_front(path,
+               svgPath(path),
+               paths,
+               coldfronts,
+               id,
+               "coldfront",
+               "coldfrontglyph",
+               Cc,
+               Cc,
+               fontsize,
+               spacing);
 }
 
 // ----------------------------------------------------------------------
@@ -11537,15 +12269,20 @@ void SvgRenderer::visit(const woml::JetStream &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("jet", "simplify", 0.0));
 
   double fontsize = 0;
   double spacing = 0;
 
-  render_front(path, paths, jets, id, "jet", "", "", "", fontsize, spacing);
+  render_front(path, svgPath(path), paths, jets, id, "jet", "", "", "", fontsize, spacing);
 }
 
 // ----------------------------------------------------------------------
@@ -11581,10 +12318,15 @@ void SvgRenderer::visit(const woml::OccludedFront &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("occludedfront", "simplify", 0.0));
 
   double fontsize = getCssSize("occludedfrontglyph", "font-size");
   double spacing = getSetting<double>("occludedfront", "letter-spacing", 60.0);
@@ -11592,6 +12334,7 @@ void SvgRenderer::visit(const woml::OccludedFront &theFeature)
   const char *CWcw = ((theFeature.orientation() == "-") ? "CW" : "cw");
 
   render_front(path,
+               svgPath(path),
                paths,
                occludedfronts,
                id,
@@ -11642,6 +12385,20 @@ void SvgRenderer::visit(const woml::ParameterValueSetPoint &theFeature)
     }
   }
 
+  if (outsideArea(theFeature.point()->lon(), theFeature.point()->lat()))
+  {
+    // Reserve the symbol and value ids to keep the ids of the other features unchanged
+
+    if (fdm)
+      ++npointsymbols;
+
+    if (svm || dynamic_cast<const woml::NumericalValueRangeMeasure *>(
+                   params->values().front().value()))
+      ++npointvalues;
+
+    return;
+  }
+
   if (fdm)
   {
     const woml::GeophysicalParameterValue &theValue = *itvfdm;
@@ -11715,6 +12472,14 @@ void SvgRenderer::visit(const woml::PointMeteorologicalSymbol &theFeature)
   if (options.debug)
     std::cerr << "Visiting PointMeteorologicalSymbol" << std::endl;
 
+  if (outsideArea(theFeature.point()->lon(), theFeature.point()->lat()))
+  {
+    // Reserve the symbol id to keep the ids of the other symbols unchanged
+
+    ++npointsymbols;
+    return;
+  }
+
   // Get the symbol class and code
   std::string symCode;
   std::string symClass = PointMeteorologicalSymbolDefinition(theFeature, symCode);
@@ -11740,6 +12505,12 @@ void SvgRenderer::visit(const woml::PointMeteorologicalSymbol &theFeature)
   {                                                                    \
     if (options.debug)                                                 \
       std::cerr << "Visiting " << theFeature.className() << std::endl; \
+    if (outsideArea(theFeature.point()->lon(),                         \
+                    theFeature.point()->lat()))                        \
+    {                                                                  \
+      ++npointsymbols;                                                 \
+      return;                                                          \
+    }                                                                  \
     render_symbol("pointMeteorologicalSymbol",                         \
                   pointsymbols,                                        \
                   theFeature.className(),                              \
@@ -11780,15 +12551,30 @@ RenderPressureCenterTypeDerivedClass(woml::AntiCyclone)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("ridge", "simplify", 0.0));
 
   double fontsize = getCssSize("ridgeglyph", "font-size");
   double spacing = getSetting<double>("ridge", "letter-spacing", 60.0);
 
-  render_front(path, paths, ridges, id, "ridge", "ridgeglyph", "r", "R", fontsize, spacing);
+  render_front(path,
+               svgPath(path),
+               paths,
+               ridges,
+               id,
+               "ridge",
+               "ridgeglyph",
+               "r",
+               "R",
+               fontsize,
+               spacing);
 }
 
 // ----------------------------------------------------------------------
@@ -11817,6 +12603,9 @@ RenderStormTypeDerivedClass(woml::ConvectiveStorm) RenderStormTypeDerivedClass(w
 
   const woml::CubicSplineSurface surface = theFeature.controlSurface();
 
+  if (outsideArea(controlBBox(*area, surface)))
+    return;
+
   Path path = PathFactory::create(surface);
 
   PathProjector proj(area);
@@ -11869,6 +12658,9 @@ void SvgRenderer::visit(const woml::ParameterValueSetArea &theFeature)
 
   const woml::CubicSplineSurface surface = theFeature.controlSurface();
 
+  if (outsideArea(controlBBox(*area, surface)))
+    return;
+
   Path path = PathFactory::create(surface);
 
   PathProjector proj(area);
@@ -11936,15 +12728,30 @@ void SvgRenderer::visit(const woml::Trough &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("trough", "simplify", 0.0));
 
   double fontsize = getCssSize("troughglyph", "font-size");
   double spacing = getSetting<double>("trough", "letter-spacing", 60.0);
 
-  render_front(path, paths, troughs, id, "trough", "troughglyph", "t", "T", fontsize, spacing);
+  render_front(path,
+               svgPath(path),
+               paths,
+               troughs,
+               id,
+               "trough",
+               "troughglyph",
+               "t",
+               "T",
+               fontsize,
+               spacing);
 }
 
 // ----------------------------------------------------------------------
@@ -11967,15 +12774,21 @@ void SvgRenderer::visit(const woml::UpperTrough &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("uppertrough", "simplify", 0.0));
 
   double fontsize = getCssSize("uppertroughglyph", "font-size");
   double spacing = getSetting<double>("uppertrough", "letter-spacing", 60.0);
 
   render_front(path,
+               svgPath(path),
                paths,
                uppertroughs,
                id,
@@ -12006,10 +12819,15 @@ void SvgRenderer::visit(const woml::WarmAdvection &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("warmadvection", "simplify", 0.0));
 
   double fontsize = getCssSize("warmadvectionglyph", "font-size");
   double spacing = getSetting<double>("warmadvection", "letter-spacing", 60.0);
@@ -12017,6 +12835,7 @@ void SvgRenderer::visit(const woml::WarmAdvection &theFeature)
   const char *Ww = ((theFeature.orientation() == "-") ? "W" : "w");
 
   render_front(path,
+               svgPath(path),
                paths,
                warmfronts,
                id,
@@ -12047,18 +12866,32 @@ void SvgRenderer::visit(const woml::WarmFront &theFeature)
 
   const woml::CubicSplineCurve splines = theFeature.controlCurve();
 
+  if (outsideArea(controlBBox(*area, splines)))
+    return;
+
   Path path = PathFactory::create(splines);
 
   PathProjector proj(area);
   path.transform(proj);
+  clipToArea(path);
+  path.simplify(getSetting<double, int>("warmfront", "simplify", 0.0));
 
   double fontsize = getCssSize("warmfrontglyph", "font-size");
   double spacing = getSetting<double>("warmfront", "letter-spacing", 60.0);
 
   const char *Ww = ((theFeature.orientation() == "-") ? "W" : "w");
 
-  render_front(
-      path, paths, warmfronts, id, "warmfront", "warmfrontglyph", Ww, Ww, fontsize, spacing);
+  render_front(path,
+               svgPath(path),
+               paths,
+               warmfronts,
+               id,
+               "warmfront",
+               "warmfrontglyph",
+               Ww,
+               Ww,
+               fontsize,
+               spacing);
 }
 
 // ----------------------------------------------------------------------
@@ -12100,6 +12933,89 @@ void SvgRenderer::visit(const woml::ZeroTolerance &theFeature)
 //  return (svgbase.find("."+theCssClass) != std::string::npos);
 //}
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Renderer's coordinate buffer cleared for new path data, using
+ *	    the configured encoding and precision. The returned writer is
+ *	    valid until the next call.
+ */
+// ----------------------------------------------------------------------
+
+CoordinateWriter &SvgRenderer::pathWriter(int defaultPrecision)
+{
+  coordinateWriter.clear();
+  coordinateWriter.precision(pathPrecision ? *pathPrecision : defaultPrecision);
+
+  return coordinateWriter;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Test if feature is outside the chart area extended by the
+ *	    configured margin and can be skipped. The margin is extended by
+ *	    a quarter of the feature's size since curves can bulge outside
+ *	    their control points.
+ */
+// ----------------------------------------------------------------------
+
+bool SvgRenderer::outsideArea(const std::optional<Path::BBox> &bbox)
+{
+  if ((!cullMargin) || (!bbox))
+    return false;
+
+  double margin = *cullMargin + 0.25 * std::max(bbox->trX - bbox->blX, bbox->trY - bbox->blY);
+
+  if ((bbox->trX + margin < 0) || (bbox->trY + margin < 0) ||
+      (bbox->blX - margin > area->Width()) || (bbox->blY - margin > area->Height()))
+  {
+    nculled++;
+    return true;
+  }
+
+  return false;
+}
+
+bool SvgRenderer::outsideArea(double lon, double lat)
+{
+  if (!cullMargin)
+    return false;
+
+  NFmiPoint xy = area->ToXY(NFmiPoint(lon, lat));
+
+  return outsideArea(Path::BBox(xy.X(), xy.Y(), xy.X(), xy.Y()));
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Clip projected path to the chart area extended by the configured
+ *	    margin
+ */
+// ----------------------------------------------------------------------
+
+void SvgRenderer::clipToArea(Path &path) const
+{
+  if (clipMargin)
+  {
+    double margin = *clipMargin;
+    path.clip(-margin, -margin, area->Width() + margin, area->Height() + margin);
+  }
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief SVG path data using the renderer's coordinate buffer. The
+ *	    returned writer is valid until the next call.
+ */
+// ----------------------------------------------------------------------
+
+const CoordinateWriter &SvgRenderer::svgPath(const Path &path)
+{
+  CoordinateWriter &writer = pathWriter(1);
+  path.svg(writer);
+
+  return writer;
+}
+
 // ----------------------------------------------------------------------
 /*!
  * \brief Find the given CSS size setting
@@ -12110,35 +13026,19 @@ double SvgRenderer::getCssSize(const std::string &theCssClass,
                                const std::string &theAttribute,
                                double defaultValue)
 {
-  std::string::size_type pos = svgbase.find("." + theCssClass);
-  if (pos == std::string::npos)
+  auto cssClass = cssClasses.find(theCssClass);
+  if (cssClass == cssClasses.end())
     return defaultValue;
 
-  // Require attribute to come before next "}"
-
-  std::string::size_type pos2 = svgbase.find("}", pos);
-  if (pos2 == std::string::npos)
-    return defaultValue;
-
-  std::string::size_type pos1 = svgbase.find(theAttribute + ":", pos);
-  if (pos1 == std::string::npos || pos1 > pos2)
+  auto attribute = cssClass->second.find(theAttribute);
+  if (attribute == cssClass->second.end())
     return defaultValue;
 
-  // Extract the next word after "attribute:"
-
-  pos1 += theAttribute.size() + 1;
-  pos2 = svgbase.find(";", pos1);
-
-  std::string word = svgbase.substr(pos1, pos2 - pos1);
-  boost::algorithm::trim(word);
-
-  if (word.substr(word.size() - 2, 2) != "px")
+  if (!attribute->second)
     throw std::runtime_error("CSS value for " + theCssClass + "." + theAttribute +
                              " must be in pixels");
 
-  std::string num = word.substr(0, word.size() - 2);
-
-  return std::stod(num);
+  return *(attribute->second);
 }
 
 // ----------------------------------------------------------------------
@@ -12158,6 +13058,23 @@ T SvgRenderer::getSetting(const std::string &theConfigClass,
   return lookup<T>(config, theConfigClass + "." + theAttribute);
 }
 
+// ----------------------------------------------------------------------
+/*!
+ * \brief Find the given config setting, reading it with secondary type on type mismatch
+ */
+// ----------------------------------------------------------------------
+
+template <typename T, typename T2>
+T SvgRenderer::getSetting(const std::string &theConfigClass,
+                          const std::string &theAttribute,
+                          T theDefaultValue)
+{
+  if (!config.exists(theConfigClass + "." + theAttribute))
+    return theDefaultValue;
+
+  return configValue<T, T2>(config.lookup(theConfigClass), theConfigClass, theAttribute);
+}
+
 // ----------------------------------------------------------------------
 /*
  * TODO: This part should be refactored when finished
@@ -12282,6 +13199,11 @@ void SvgRenderer::contour(const std::shared_ptr<NFmiQueryData> &theQD,
       float stop = lookup<float>(specs, "contourlines", "stop");
       float step = lookup<float>(specs, "contourlines", "step");
 
+      // Optional simplification of the lines (tolerance in pixels)
+
+      double simplify =
+          configValue<double, int>(specs, "contourlines", "simplify", nullptr, s_optional);
+
       const libconfig::Setting &labels = specs["labels"];
       if (!labels.isGroup())
         throw std::runtime_error("contourlines labels must be a group");
@@ -12353,13 +13275,15 @@ void SvgRenderer::contour(const std::shared_ptr<NFmiQueryData> &theQD,
         MyContourer::line(builder, grid, value, hints);
 
         PathAdapter pathAdapter;
-        const Path &path = GeosTools::getContours(&(*builder.result()), pathAdapter);
+        Path path = GeosTools::getContours(&(*builder.result()), pathAdapter);
+        clipToArea(path);
+        path.simplify(simplify);
 
         if (!path.empty())
         {
           ++linenumber;
           std::string id = ("contourline" + Fmi::to_string(linenumber));
-          paths << "<path id=\"" << id << "\" d=\"" << path.svg() << "\"/>\n";
+          paths << "<path id=\"" << id << "\" d=\"" << svgPath(path) << "\"/>\n";
 
           contours[outputname] << "<use class=\"" << classname << "\" xlink:href=\"#" << id
                                << "\"/>\n";
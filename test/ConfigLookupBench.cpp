@@ -0,0 +1,208 @@
+// ======================================================================
+/*!
+ * \brief Micro-benchmark for configuration lookups
+ *
+ * Compares the cost of reading optional settings from the list type
+ * blocks (Surface, pointMeteorologicalSymbol etc.) of a template's
+ * configuration by catching libconfig exceptions for missing settings
+ * and settings with wrong type, and by using the non-throwing lookups.
+ *
+ * Usage: ConfigLookupBench <template> [iterations]
+ */
+// ======================================================================
+
+#include "ConfigTools.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace frontier;
+
+namespace
+{
+// Settings commonly read for each block; most of them are optional and missing
+
+const char *params[] = {"type",      "class",     "style",    "output",       "scale",
+                        "width",     "height",    "locale",   "xoffset",      "yoffset",
+                        "autoscale", "showareas", "fillmode", "textposition", "url",
+                        "folder",    "code",      "margin",   "font-family",  "font-size"};
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Read the libconfig section of the template
+ */
+// ----------------------------------------------------------------------
+
+void readconfig(libconfig::Config &config, const std::string &templateFile)
+{
+  std::ifstream in(templateFile.c_str());
+  if (!in)
+    throw std::runtime_error("Failed to open '" + templateFile + "'");
+
+  std::stringstream contents;
+  contents << in.rdbuf();
+
+  std::string svg = contents.str();
+  std::string::size_type pos1 = svg.find("<frontier>"), pos2 = svg.find("</frontier>");
+
+  if ((pos1 == std::string::npos) || (pos2 == std::string::npos))
+    throw std::runtime_error("No frontier configuration in '" + templateFile + "'");
+
+  pos1 += strlen("<frontier>");
+
+  std::string filename = ("/tmp/frontierbench_" + std::to_string(getpid()) + ".cnf");
+  std::ofstream out(filename.c_str());
+  if (!out)
+    throw std::runtime_error("Failed to open '" + filename + "' for writing");
+  out << svg.substr(pos1, pos2 - pos1);
+  out.close();
+
+  config.readFile(filename.c_str());
+  unlink(filename.c_str());
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Read a setting as string or as number, using exceptions
+ */
+// ----------------------------------------------------------------------
+
+bool lookupThrowing(const libconfig::Setting &block, const char *name, std::string &value)
+{
+  try
+  {
+    try
+    {
+      value = (const char *)block.lookup(name);
+    }
+    catch (const libconfig::SettingTypeException &)
+    {
+      value = std::to_string((double)block.lookup(name));
+    }
+
+    return true;
+  }
+  catch (const libconfig::ConfigException &)
+  {
+    return false;
+  }
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Read a setting as string or as number without exceptions
+ */
+// ----------------------------------------------------------------------
+
+bool lookupOptional(const libconfig::Setting &block, const char *name, std::string &value)
+{
+  bool typeMismatch;
+  std::optional<std::string> s = lookup_optional<std::string>(block, name, &typeMismatch);
+
+  if (s)
+    value = *s;
+  else if (typeMismatch)
+  {
+    std::optional<double> d = lookup_optional<double>(block, name);
+
+    if (!d)
+      return false;
+
+    value = std::to_string(*d);
+  }
+
+  return (s || typeMismatch);
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Time the lookups of all parameters from all blocks
+ */
+// ----------------------------------------------------------------------
+
+template <typename F>
+double timeLookups(const std::vector<const libconfig::Setting *> &blocks,
+                   int iterations,
+                   F lookupFunc,
+                   size_t &nLookups,
+                   size_t &nFound)
+{
+  std::string value;
+  nLookups = nFound = 0;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; (i < iterations); i++)
+    for (const libconfig::Setting *block : blocks)
+      for (const char *param : params)
+      {
+        nLookups++;
+
+        if (lookupFunc(*block, param, value))
+          nFound++;
+      }
+
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  return (nLookups > 0) ? (elapsed.count() / nLookups) : 0.0;
+}
+
+}  // namespace
+
+int main(int argc, const char *argv[])
+try
+{
+  if ((argc < 2) || (argc > 3))
+  {
+    std::cerr << "Usage: " << argv[0] << " <template> [iterations]\n";
+    return 1;
+  }
+
+  int iterations = ((argc == 3) ? atoi(argv[2]) : 1000);
+
+  libconfig::Config config;
+  readconfig(config, argv[1]);
+
+  // Collect the blocks of all list type settings
+
+  std::vector<const libconfig::Setting *> blocks;
+  const libconfig::Setting &root = config.getRoot();
+
+  for (int i = 0; (i < root.getLength()); i++)
+    if (root[i].isList())
+      for (int j = 0; (j < root[i].getLength()); j++)
+        if (root[i][j].isGroup())
+          blocks.push_back(&root[i][j]);
+
+  size_t nLookups, nFound;
+
+  double tThrowing = timeLookups(blocks, iterations, lookupThrowing, nLookups, nFound);
+  std::cout << "exceptions: " << tThrowing << " ns/lookup (" << nLookups << " lookups, " << nFound
+            << " found)\n";
+
+  double tOptional = timeLookups(blocks, iterations, lookupOptional, nLookups, nFound);
+  std::cout << "optional:   " << tOptional << " ns/lookup (" << nLookups << " lookups, " << nFound
+            << " found)\n";
+
+  return 0;
+}
+catch (libconfig::ParseException &e)
+{
+  std::cerr << "Error: " << e.getError() << " on line " << e.getLine() << std::endl;
+  return 1;
+}
+catch (std::exception &e)
+{
+  std::cerr << "Error: " << e.what() << std::endl;
+  return 1;
+}
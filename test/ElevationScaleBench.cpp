@@ -0,0 +1,169 @@
+// ======================================================================
+/*!
+ * \brief Micro-benchmark for elevation axis scaling
+ *
+ * Compares the cost of scaling elevations to relative axis positions
+ * by searching a list of elevation objects (the former implementation
+ * of AxisManager::scaledElevation()) and by using ElevationScale.
+ * The results of both methods are checked to be equal.
+ *
+ * Usage: ElevationScaleBench [iterations]
+ */
+// ======================================================================
+
+#include "ElevationScale.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace frontier;
+
+namespace
+{
+// Elevation axis breakpoints (meters) and their relative positions, resembling
+// the aerodrome and cross section templates
+
+const double axis[][2] = {{0, 0.0},
+                          {150, 0.05},
+                          {300, 0.1},
+                          {600, 0.17},
+                          {900, 0.23},
+                          {1500, 0.33},
+                          {2000, 0.4},
+                          {3000, 0.5},
+                          {4000, 0.58},
+                          {5000, 0.65},
+                          {6000, 0.72},
+                          {7500, 0.8},
+                          {9000, 0.87},
+                          {10500, 0.93},
+                          {12000, 1.0}};
+
+// Former elevation list element with labels
+
+class Elevation
+{
+ public:
+  Elevation(double theElevation, double theScale = 0.0)
+      : itsElevation(theElevation), itsScale(theScale), itsFactor(0.0)
+  {
+  }
+
+  bool operator<(const Elevation &theOther) const { return itsElevation < theOther.itsElevation; }
+
+  double itsElevation;
+  double itsScale;
+  std::string itsLLabel;
+  std::string itsRLabel;
+  double itsFactor;
+};
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Scale elevation by searching the elevation list
+ */
+// ----------------------------------------------------------------------
+
+double listScale(std::list<Elevation> &elevations, double elevation)
+{
+  std::list<Elevation>::iterator ith =
+      lower_bound(elevations.begin(), elevations.end(), Elevation(elevation));
+  if (ith == elevations.end())
+    return 0;
+
+  if (ith->itsElevation > elevation)
+  {
+    std::list<Elevation>::iterator itl = ith;
+    itl--;
+
+    return itl->itsScale + ((elevation - itl->itsElevation) * itl->itsFactor);
+  }
+
+  return ith->itsScale;
+}
+
+// ----------------------------------------------------------------------
+/*!
+ * \brief Time scaling of all elevations
+ */
+// ----------------------------------------------------------------------
+
+template <typename F>
+double timeScaling(const std::vector<double> &values, int iterations, F scaleFunc, double &sum)
+{
+  sum = 0.0;
+
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; (i < iterations); i++)
+    for (double value : values)
+      sum += scaleFunc(value);
+
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  size_t nScaled = values.size() * iterations;
+
+  return (nScaled > 0) ? (elapsed.count() / nScaled) : 0.0;
+}
+
+}  // namespace
+
+int main(int argc, const char *argv[])
+{
+  if (argc > 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " [iterations]\n";
+    return 1;
+  }
+
+  int iterations = ((argc == 2) ? atoi(argv[1]) : 1000);
+
+  std::list<Elevation> elevations;
+  ElevationScale elevationScale;
+
+  for (const auto &breakpoint : axis)
+  {
+    if (!elevations.empty())
+      elevations.back().itsFactor = (breakpoint[1] - elevations.back().itsScale) /
+                                    (breakpoint[0] - elevations.back().itsElevation);
+
+    elevations.push_back(Elevation(breakpoint[0], breakpoint[1]));
+    elevationScale.add(breakpoint[0], breakpoint[1]);
+  }
+
+  // Elevations within the axis range, including the breakpoints
+
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<double> dist(1.0, 11999.0);
+  std::vector<double> values(10000);
+
+  for (double &value : values)
+    value = dist(rng);
+  for (const auto &breakpoint : axis)
+    if ((breakpoint[0] > 0) && (breakpoint[0] < 12000))
+      values.push_back(breakpoint[0]);
+
+  for (double value : values)
+    if (listScale(elevations, value) != elevationScale.scale(value))
+    {
+      std::cerr << "Error: results differ for elevation " << value << std::endl;
+      return 1;
+    }
+
+  double listSum, scaleSum;
+
+  double tList = timeScaling(
+      values, iterations, [&](double e) { return listScale(elevations, e); }, listSum);
+  std::cout << "list:   " << tList << " ns/elevation (checksum " << listSum << ")\n";
+
+  double tScale = timeScaling(
+      values, iterations, [&](double e) { return elevationScale.scale(e); }, scaleSum);
+  std::cout << "scale:  " << tScale << " ns/elevation (checksum " << scaleSum << ")\n";
+
+  return 0;
+}
@@ -42,3 +42,23 @@ if [[ -z  "$result" ]]; then
 else
     ./CompareImages.sh $result $expected
 fi
+
+#####
+
+# Clipping and culling; checks that the margins are accepted and the chart renders
+
+name="europe-forecast-clipped-fi${suffix}"
+printf "%s %s " $name "${dots:${#name}}"
+frontier -w woml/europe-forecast.woml -s tpl/europe-forecast-clipped.tpl -p stereographic,5,90,60:-12.24349761,31.83310001,74.66294552,54.86671043:458,-1 -d -t conceptualmodelanalysis -l FI-fi > failures/${name}.svg 2>/dev/null
+status=$?
+result=failures/${name}.svg
+expected=output/${name}.svg
+
+if [[ $status -ne 0 || ! -s "$result" ]]; then
+    echo "FAIL - NO OUTPUT"
+elif [[ -e "$expected" ]]; then
+    ./CompareImages.sh $result $expected
+else
+    echo "OK"
+    rm -f $result
+fi
@@ -0,0 +1,1019 @@
+<svg xmlns="http://www.w3.org/2000/svg" xmlns:xlink="http://www.w3.org/1999/xlink"  width="--WIDTH--px" height="--HEIGHT--px" viewBox="0 0 --WIDTH-- --HEIGHT--">
+<title>Weather Fronts</title>
+
+<defs>
+
+ <!-- *** CUSTOMER SPECIFIC FIXED PART STARTS *** -->
+
+ <!--
+
+ frontier C++ configuration
+
+ <frontier>
+
+models:
+  {
+    ECMWF = "querydata/ecmwf/";
+    HirlamRCR = "querydata/hirlam/";
+  };
+
+# Clip paths and skip features outside the chart area (margins in pixels)
+
+clipmargin = 50;
+cullmargin = 20;
+
+
+
+ParameterValueSetPoint:
+ (
+ 	{
+		width  = 60;
+		height = 60;
+		scale = 0.5;
+	},
+		{
+  		name     = "Wind@FlowWind";
+		type     = "svg";
+  		folder   = "33";
+		code_NW  = "viol_135";
+		code_NNW = "viol_157";	
+		code_N   = "viol_180";
+		code_NNE = "viol_202";
+		code_NE  = "viol_225";	
+		code_ENE = "viol_247";
+		code_E   = "viol_270";
+		code_ESE = "viol_292";
+		code_SE  = "viol_315";
+		code_SSE = "viol_337";
+		code_S   = "viol_360";
+		code_SSW = "viol_22";
+		code_SW  = "viol_45";
+		code_WSW = "viol_67";
+		code_W   = "viol_90";
+		code_WNW = "viol_112";
+	},
+		{
+  		name     = "Wind@ColdFlowWind";
+		type     = "svg";
+  		folder   = "33";
+		code_NW  = "sin_135";
+		code_NNW = "sin_157";	
+		code_N   = "sin_180";
+		code_NNE = "sin_202";
+		code_NE  = "sin_225";	
+		code_ENE = "sin_247";
+		code_E   = "sin_270";
+		code_ESE = "sin_292";
+		code_SE  = "sin_315";
+		code_SSE = "sin_337";
+		code_S   = "sin_360";
+		code_SSW = "sin_22";
+		code_SW  = "sin_45";
+		code_WSW = "sin_67";
+		code_W   = "sin_90";
+		code_WNW = "sin_112";
+	},
+		{
+  		name     = "Wind@WarmFlowWind";
+		type     = "svg";
+  		folder   = "33";
+		code_NW  = "pun_135";
+		code_NNW = "pun_157";	
+		code_N   = "pun_180";
+		code_NNE = "pun_202";
+		code_NE  = "pun_225";	
+		code_ENE = "pun_247";
+		code_E   = "pun_270";
+		code_ESE = "pun_292";
+		code_SE  = "pun_315";
+		code_SSE = "pun_337";
+		code_S   = "pun_360";
+		code_SSW = "pun_22";
+		code_SW  = "pun_45";
+		code_WSW = "pun_67";
+		code_W   = "pun_90";
+		code_WNW = "pun_112";	
+	},
+
+ 	{
+		name       = "Temperature@4";
+                type       = "value";
+		pref 	   = "%2.0f";
+		href       = "temperatureSingle";
+		class      = "Temperaturevalue TemperaturevalueEurope";
+		
+		#prefRange  = "%.0f..%.0f";
+		#hrefRange  = "temperatureSingle";
+		classRange = "TemperaturevalueNone";	
+		
+		conditions =
+		(
+			{
+			refix = "lt";
+			value = 0.0;
+			class = "Temperaturevalue TemperaturevalueEurope";	
+			},
+			{
+			refix = "gt";
+			value = 0.0;
+			pref  = "+%.0f";
+			class = "Temperaturevalue TemperaturevalueEurope";	
+			}
+		);
+	}
+	
+ );
+
+pointMeteorologicalSymbol:
+(
+	{
+		width  = 40;
+		height = 40;
+		scale = 0.5;
+	},
+	{
+	    name   = "PresentWeather";
+		type   = "svg";
+		folder = "17";
+		code_45 = "Sumu";
+		code_60 = "Vesi1";
+		code_70 = "Lumi1";
+		code_56 = "Jaatavatihku";
+		code_66 = "Jaatavasade";
+		code_80 = "Vesikuuro";
+		code_83 = "Rantakuuro";
+		code_85 = "Lumikuuro";
+		code_95 = "Ukkonen";
+	},
+	{
+	  	name   = "LowPressureCenter";
+	  	locale = "en-en";
+		type   = "svg";
+		folder = "17";
+		code   = "L";
+	
+	},
+	{
+	  	name   = "LowPressureCenter";
+	  	locale = "sv-se";
+		type   = "svg";
+		folder = "17";
+		code   = "L";
+	
+	},
+
+	{
+	  	name   = "LowPressureCenter";
+		type   = "svg";
+		folder = "17";
+		code   = "M";
+	
+	},
+	{
+	  	name   = "HighPressureCenter";
+	  	locale = "en-en";
+		type   = "svg";
+		folder = "17";
+		code   = "H";
+	},
+	{
+	  	name   = "HighPressureCenter";
+	  	locale = "sv-se";
+		type   = "svg";
+		folder = "17";
+		code   = "H";
+	},
+	{
+	  	name   = "HighPressureCenter";
+		type   = "svg";
+		folder = "17";
+		code   = "K";
+	}
+);
+
+
+  contourlines:
+  (
+    {
+      parameter = "Pressure";
+      start     = 900.0;
+      stop      = 1100.0;
+      step      = 5.0;
+      class     = "Pressurecontour";
+      output    = "--PRESSURELINES--";
+
+      smoother        = "Savitzky-Golay";
+      smoother-size   = 5;  // 0...6
+      smoother-degree = 2;  // 0...5
+
+     labels:
+     {
+          modulo      = 5;
+	  class       = "PressureLabel";
+	  symbol      = "PressureBox";
+     	  symbolclass = "PressureBox";
+     	  output      = "--PRESSURELABELS--";
+	  mindistance = 5.0;
+
+      coordinates = [
+20,20, 70,20, 120,20, 170,20, 220,20, 270,20, 320,20, 370,20, 420,20, 470,20, 520,20, 570,20, 620,20, 670,20, 720,20, 770,20, 820,20, 870,20, 920,20, 970,20, 1020,20, 1070,20, 1120,20, 1170,20, 1220,20, 1270,20, 1320,20, 1370,20, 1420,20, 1470,20, 
+45,70, 95,70, 145,70, 195,70, 245,70, 295,70, 345,70, 395,70, 445,70, 495,70, 545,70, 595,70, 645,70, 695,70, 745,70, 795,70, 845,70, 895,70, 945,70, 995,70, 1045,70, 1095,70, 1145,70, 1195,70, 1245,70, 1295,70, 1345,70, 1395,70, 1445,70, 1495,70, 
+20,120, 70,120, 120,120, 170,120, 220,120, 270,120, 320,120, 370,120, 420,120, 470,120, 520,120, 570,120, 620,120, 670,120, 720,120, 770,120, 820,120, 870,120, 920,120, 970,120, 1020,120, 1070,120, 1120,120, 1170,120, 1220,120, 1270,120, 1320,120, 1370,120, 1420,120, 1470,120, 
+45,170, 95,170, 145,170, 195,170, 245,170, 295,170, 345,170, 395,170, 445,170, 495,170, 545,170, 595,170, 645,170, 695,170, 745,170, 795,170, 845,170, 895,170, 945,170, 995,170, 1045,170, 1095,170, 1145,170, 1195,170, 1245,170, 1295,170, 1345,170, 1395,170, 1445,170, 1495,170, 
+20,220, 70,220, 120,220, 170,220, 220,220, 270,220, 320,220, 370,220, 420,220, 470,220, 520,220, 570,220, 620,220, 670,220, 720,220, 770,220, 820,220, 870,220, 920,220, 970,220, 1020,220, 1070,220, 1120,220, 1170,220, 1220,220, 1270,220, 1320,220, 1370,220, 1420,220, 1470,220, 
+45,270, 95,270, 145,270, 195,270, 245,270, 295,270, 345,270, 395,270, 445,270, 495,270, 545,270, 595,270, 645,270, 695,270, 745,270, 795,270, 845,270, 895,270, 945,270, 995,270, 1045,270, 1095,270, 1145,270, 1195,270, 1245,270, 1295,270, 1345,270, 1395,270, 1445,270, 1495,270, 
+20,320, 70,320, 120,320, 170,320, 220,320, 270,320, 320,320, 370,320, 420,320, 470,320, 520,320, 570,320, 620,320, 670,320, 720,320, 770,320, 820,320, 870,320, 920,320, 970,320, 1020,320, 1070,320, 1120,320, 1170,320, 1220,320, 1270,320, 1320,320, 1370,320, 1420,320, 1470,320, 
+45,370, 95,370, 145,370, 195,370, 245,370, 295,370, 345,370, 395,370, 445,370, 495,370, 545,370, 595,370, 645,370, 695,370, 745,370, 795,370, 845,370, 895,370, 945,370, 995,370, 1045,370, 1095,370, 1145,370, 1195,370, 1245,370, 1295,370, 1345,370, 1395,370, 1445,370, 1495,370, 
+20,420, 70,420, 120,420, 170,420, 220,420, 270,420, 320,420, 370,420, 420,420, 470,420, 520,420, 570,420, 620,420, 670,420, 720,420, 770,420, 820,420, 870,420, 920,420, 970,420, 1020,420, 1070,420, 1120,420, 1170,420, 1220,420, 1270,420, 1320,420, 1370,420, 1420,420, 1470,420, 
+45,470, 95,470, 145,470, 195,470, 245,470, 295,470, 345,470, 395,470, 445,470, 495,470, 545,470, 595,470, 645,470, 695,470, 745,470, 795,470, 845,470, 895,470, 945,470, 995,470, 1045,470, 1095,470, 1145,470, 1195,470, 1245,470, 1295,470, 1345,470, 1395,470, 1445,470, 1495,470, 
+20,520, 70,520, 120,520, 170,520, 220,520, 270,520, 320,520, 370,520, 420,520, 470,520, 520,520, 570,520, 620,520, 670,520, 720,520, 770,520, 820,520, 870,520, 920,520, 970,520, 1020,520, 1070,520, 1120,520, 1170,520, 1220,520, 1270,520, 1320,520, 1370,520, 1420,520, 1470,520, 
+45,570, 95,570, 145,570, 195,570, 245,570, 295,570, 345,570, 395,570, 445,570, 495,570, 545,570, 595,570, 645,570, 695,570, 745,570, 795,570, 845,570, 895,570, 945,570, 995,570, 1045,570, 1095,570, 1145,570, 1195,570, 1245,570, 1295,570, 1345,570, 1395,570, 1445,570, 1495,570, 
+20,620, 70,620, 120,620, 170,620, 220,620, 270,620, 320,620, 370,620, 420,620, 470,620, 520,620, 570,620, 620,620, 670,620, 720,620, 770,620, 820,620, 870,620, 920,620, 970,620, 1020,620, 1070,620, 1120,620, 1170,620, 1220,620, 1270,620, 1320,620, 1370,620, 1420,620, 1470,620, 
+45,670, 95,670, 145,670, 195,670, 245,670, 295,670, 345,670, 395,670, 445,670, 495,670, 545,670, 595,670, 645,670, 695,670, 745,670, 795,670, 845,670, 895,670, 945,670, 995,670, 1045,670, 1095,670, 1145,670, 1195,670, 1245,670, 1295,670, 1345,670, 1395,670, 1445,670, 1495,670, 
+20,720, 70,720, 120,720, 170,720, 220,720, 270,720, 320,720, 370,720, 420,720, 470,720, 520,720, 570,720, 620,720, 670,720, 720,720, 770,720, 820,720, 870,720, 920,720, 970,720, 1020,720, 1070,720, 1120,720, 1170,720, 1220,720, 1270,720, 1320,720, 1370,720, 1420,720, 1470,720, 
+45,770, 95,770, 145,770, 195,770, 245,770, 295,770, 345,770, 395,770, 445,770, 495,770, 545,770, 595,770, 645,770, 695,770, 745,770, 795,770, 845,770, 895,770, 945,770, 995,770, 1045,770, 1095,770, 1145,770, 1195,770, 1245,770, 1295,770, 1345,770, 1395,770, 1445,770, 1495,770, 
+20,820, 70,820, 120,820, 170,820, 220,820, 270,820, 320,820, 370,820, 420,820, 470,820, 520,820, 570,820, 620,820, 670,820, 720,820, 770,820, 820,820, 870,820, 920,820, 970,820, 1020,820, 1070,820, 1120,820, 1170,820, 1220,820, 1270,820, 1320,820, 1370,820, 1420,820, 1470,820, 
+45,870, 95,870, 145,870, 195,870, 245,870, 295,870, 345,870, 395,870, 445,870, 495,870, 545,870, 595,870, 645,870, 695,870, 745,870, 795,870, 845,870, 895,870, 945,870, 995,870, 1045,870, 1095,870, 1145,870, 1195,870, 1245,870, 1295,870, 1345,870, 1395,870, 1445,870, 1495,870, 
+20,920, 70,920, 120,920, 170,920, 220,920, 270,920, 320,920, 370,920, 420,920, 470,920, 520,920, 570,920, 620,920, 670,920, 720,920, 770,920, 820,920, 870,920, 920,920, 970,920, 1020,920, 1070,920, 1120,920, 1170,920, 1220,920, 1270,920, 1320,920, 1370,920, 1420,920, 1470,920, 
+45,970, 95,970, 145,970, 195,970, 245,970, 295,970, 345,970, 395,970, 445,970, 495,970, 545,970, 595,970, 645,970, 695,970, 745,970, 795,970, 845,970, 895,970, 945,970, 995,970, 1045,970, 1095,970, 1145,970, 1195,970, 1245,970, 1295,970, 1345,970, 1395,970, 1445,970, 1495,970];
+     };
+    }
+  );
+
+
+Surface:
+(
+
+	{
+    		name    = "unknown";
+     		type    = "mask";
+		style   = "";
+		mask    = "precipitationMask";
+		class   = "precipitation";
+   	},
+
+	{
+    		name    = "unknown";
+     		type    = "pattern";
+		style   = "";
+   	},
+	{
+    		name    = "rain";
+     		type    = "pattern";
+		style   = "";
+   	},
+	{
+    		name    = "snow";
+     		type    = "pattern";
+     		style   = "fill:url(#rain_pattern)";
+   	},
+	{
+    		name    = "sleet";
+     		type    = "pattern";
+     		style   = "fill:url(#rain_pattern)";
+   	},
+	{
+    		name    = "hail";
+     		type    = "pattern";
+     		style   = "fill:url(#rain_pattern)";
+   	},
+	{
+    		name    = "drizzle";
+     		type    = "pattern";
+     		style   = "fill:url(#rain_pattern)";
+   	},
+	{
+    		name    = "freezing-precipitation";
+     		type    = "pattern";
+     		style   = "fill:url(#rain_pattern)";
+   	}
+);
+
+
+ graphicsymbol:
+ {
+     size = 30.0;
+ };
+
+ coldfront:
+ {
+     letter-spacing = 30.0;
+ };
+ warmfront:
+ {
+     letter-spacing = 30.0;
+ };
+ occludedfront:
+ {
+     letter-spacing = 30.0;
+ };
+ trough:
+ {
+     letter-spacing = 0.0;
+ };
+ uppertrough:
+ {
+     letter-spacing = 0.0;
+ };
+ jet:
+ {
+     letter-spacing = 0.0;
+ };
+ 
+ </frontier>
+
+ -->
+  <style type="text/css"><![CDATA[
+  ]]></style>
+
+
+<style type="text/css"><![CDATA[
+
+ .M,.K
+ {
+   stroke-width: 1.3px;
+   stroke: white;
+ }
+
+
+.weather
+ {
+   filter: none;
+ }
+
+ .postweather
+ {
+   filter: none;
+ }
+  .TemperaturevalueEurope {
+    fill: black;
+    font-size: 12px;
+  }
+  .TemperaturevalueNone {
+      fill-opacity:0.2;
+  }
+  .coldfront
+ {
+   stroke: rgb(0,174,239);
+   fill: none;
+   stroke-width: 4px;
+   stroke-linecap: round;
+ }
+
+ .coldfrontglyph
+ {
+   font-family: Frontier;
+   font-size: 17px;
+   text-anchor: middle;
+   fill: rgb(0,174,239);
+   fmi-letter-spacing: 60px;
+ }
+
+ .warmfront
+ {
+   stroke: rgb(237,33,36);
+   fill: none;
+   stroke-width: 4px;
+   stroke-linecap: round;
+ }
+
+ .warmfrontglyph
+ {
+   font-family: Frontier;
+   font-size: 17px;
+   text-anchor: middle;
+   fill: rgb(237,33,36);
+   fmi-letter-spacing: 60px;
+ }
+
+ .occludedfront
+ {
+   stroke: rgb(180,30,142);
+   fill: none;
+   stroke-width: 4px;
+   stroke-linecap: round;
+ }
+
+ .occludedfrontglyph
+ {
+   font-family: Frontier;
+   font-size: 17px;
+   text-anchor: middle;
+   fill: rgb(180,30,142);
+   fmi-letter-spacing: 60px;
+ }
+
+ .trough
+ {
+   fill: none;
+   stroke: rgb(180,30,142);
+   stroke-width: 4px;
+   stroke-dasharray: 15,10;
+   stroke-linecap: round;
+ }
+
+ .troughglyph
+ {
+   font-family: Frontier;
+   fill: rgb(180,30,142);
+   stroke: none;
+   text-anchor: middle;
+   font-size: 0px;
+   fmi-letter-spacing: 0px;
+ }
+
+ .Pressurecontour
+ {
+   fill: none;
+   stroke: #000;
+   stroke-width: 0.5px;
+   
+ }
+
+ .PressureLabel
+ {
+     font-family: Arial;
+     font-size: 7px;
+     text-anchor: middle;
+ }
+ .PressureBox
+ {
+     stroke-width: 0.2px;
+     stroke: none;
+     fill: white;
+ }
+
+]]></style>
+
+  <g id="temperatureSingle">
+   <rect width="24" height="14" x="-11" y="-11"
+    style="stroke: black;
+    stroke-opacity: 1; 
+    stroke-width: 1;
+    fill-opacity: 1;
+    fill: white" />
+  </g>
+
+ <!-- weather font -->
+
+ <font>
+  <font-face font-family="Frontier" units-per-em="100" alphabetic="0"/>
+  <missing-glyph horiz-adv-x="100" d="M0,0 L0,0 0,50 50,50z"/>
+
+  <!-- warm front -->
+  <glyph unicode="w" horiz-adv-x="100" d="M0,0 A 50,50 0 0 1 100,0z"/>
+  <glyph unicode="W" horiz-adv-x="100" d="M0,0 A 50,50 0 0 0 100,0z"/>
+
+  <!-- cold front -->
+  <glyph unicode="c" horiz-adv-x="100" d="M0,0 L 50,-80 100,0z"/>
+  <glyph unicode="C" horiz-adv-x="100" d="M0,0 L 50,80 100,0z"/>
+
+  <!-- trough -->
+  <glyph unicode="t" horiz-adv-x="100" d="M0,0 L -90,50 -80,45 25,0z"/>
+  <glyph unicode="T" horiz-adv-x="100" d="M0,0 L -90,-50 -80,-45 25,0z"/>
+
+  <!-- glyph unicode="t" horiz-adv-x="100" d="M0,0 L 80,50 90,45 25,0z"/-->
+  <!-- glyph unicode="T" horiz-adv-x="100" d="M0,0 L 80,-50 90,-45 25,0z"/-->
+
+ </font>
+
+ <!-- markers -->
+
+ <!-- gradients -->
+
+ <!-- patterns -->
+
+ <pattern id="rain_pattern" patternUnits="userSpaceOnUse" x="0" y="0" width="8" height="8">
+   <g style="fill:none; stroke:black; stroke-width:1">
+    	<path d="M8,0 l-8,8"/>
+   </g>
+  </pattern>  
+
+ <!-- filters -->
+ 
+<filter id="shadow" width="150%" height="150%">
+  <feOffset in="SourceAlpha" result="offsetted" dx="2" dy="3"/>
+  <feGaussianBlur in="offsetted" result="blurred" stdDeviation="2.5"/>
+  <feBlend in="SourceGraphic" in2="blurred" mode="normal"/>
+ </filter>
+
+ <filter id="emboss">
+  <feGaussianBlur in="SourceAlpha" result="blurred" stdDeviation="6"/>
+  <feSpecularLighting in="blurred" result="lighted" surfaceScale="-3" style="lighting-color:white" specularConstant="1" specularExponent="16" kernelUnitLength="1" >
+   <feDistantLight azimuth="70" elevation="30"/>
+  </feSpecularLighting>
+  <feComposite in="lighted" in2="SourceGraphic" operator="in"/>
+ </filter>
+
+ <!-- symbols -->
+
+<symbol id="PressureBox">
+ <rect width="18px" height="10px" x="-9px" y="-7px" rx="2" ry="2"/>
+</symbol>
+
+
+
+ <g id="pun_112">
+   <path fill="#FB0F0C" d="M9.7177734,3.7910156L10.4501953,0L0,4.8457031l7.7915039,8.8359375l0.7265625-3.7119141    c12.347168,3.1259766,22.277832,8.1738281,28.7114258,13.5263672l-2.7050781-6.9462891l6.578125-1.6289063    C27.7431641,7.8017578,19.5849609,5.8798828,9.7177734,3.7910156z"/>
+ </g>
+ <g id="pun_135">
+   <path fill="#FB0F0C" d="M9.3867188,3.2226563L11.5107422,0L0,0.4804688L3.8129883,11.625l2.090332-3.1494141    c10.2128906,7.6142578,17.456543,16.0751953,21.347168,23.484375l0.1582031-7.4589844l6.703125,1.0166016    C24.5024414,13.8222656,17.7055664,8.9238281,9.3867188,3.2226563z"/>
+ </g>
+ <g id="pun_157">
+   <path fill="#FB0F0C" d="M8.3613281,6.1201172l3.1977539-2.1621094L0.7441406,0L0,11.7568359l3.140625-2.1123047    c6.5229492,10.9394531,9.9799805,21.5361328,10.7416992,29.8652344l2.9941406-6.8291016l5.8095703,3.4980469    C18.2797852,21.7001953,13.8647461,14.5722656,8.3613281,6.1201172z"/>
+ </g>
+ <g id="pun_180">
+   <path fill="#FB0F0C" d="M9.878418,8.578125l3.7792969-0.7763672L5.1870117,0L0,10.5761719l3.7089844-0.75    c1.8325195,12.6064453,0.9770508,23.71875-1.5131836,31.7021484L7.5849609,36.375l4.0219727,5.4521484    C13.0717773,26.765625,11.7338867,18.4921875,9.878418,8.578125z"/>
+ </g>
+ <g id="pun_202">
+   <path fill="#FB0F0C" d="M19.7045898,9.7207031l3.7949219,0.7236328L18.6557617,0L9.8129883,7.7900391l3.7148438,0.7265625    C10.4018555,20.8652344,5.3554688,30.8027344,0,37.2304688l6.9536133-2.7099609l1.6289063,6.5771484    C15.6967773,27.7412109,17.6186523,19.5878906,19.7045898,9.7207031z"/>
+ </g>
+ <g id="pun_22">
+   <path fill="#FB0F0C" d="M3.7924805,31.3803711L0,30.6499023l4.8486328,10.4453125l8.831543-7.7871094l-3.7075195-0.7304688    c3.1274414-12.3452148,8.1694336-22.2797852,13.5219727-28.7075195l-6.9462891,2.7099609L14.9194336,0    C7.7973633,13.3535156,5.8740234,21.5131836,3.7924805,31.3803711z"/>
+ </g>
+ <g id="pun_225">
+   <path fill="#FB0F0C" d="M28.7382813,9.3837891l3.2226563,2.1240234L31.4804688,0L20.3359375,3.8144531L23.4882813,5.90625    C15.8701172,16.1132813,7.4106445,23.3637695,0,27.2543945l7.4619141,0.15625l-1.0151367,6.7050781    C18.1347656,24.4985352,23.0410156,17.7036133,28.7382813,9.3837891z"/>
+ </g>
+ <g id="pun_247">
+   <path fill="#FB0F0C" d="M33.3950195,8.3642578l2.1621094,3.1904297l3.9609375-10.8134766L27.7583008,0l2.1152344,3.140625    C18.9301758,9.6591797,8.3334961,13.1162109,0,13.875l6.8305664,3l-3.4980469,5.8125    C17.8110352,18.2753906,24.9399414,13.8662109,33.3950195,8.3642578z"/>
+ </g>
+ <g id="pun_270">
+   <path fill="#FB0F0C" d="M33.2446289,9.8818359l0.7734375,3.7822266l7.8017578-8.4785156L31.2436523,0l0.7441406,3.703125    C19.3886719,5.5371094,8.2792969,4.6816406,0.2929688,2.1943359L5.456543,7.5791016L0,11.6074219    C15.0556641,13.0693359,23.3334961,11.7333984,33.2446289,9.8818359z"/>
+ </g>
+ <g id="pun_292">
+   <path fill="#FB0F0C" d="M31.3798828,19.7084961l-0.7207031,3.7871094l10.4414063-4.8457031l-7.7871094-8.8325195    l-0.7265625,3.7055664C20.2382813,10.3945313,10.3022461,5.3525391,3.8730469,0l2.7099609,6.9462891L0,8.5751953    C13.3623047,15.6948242,21.5200195,17.6245117,31.3798828,19.7084961z"/>
+ </g>
+ <g id="pun_315">
+   <path fill="#FB0F0C" d="M24.7314453,28.7373047l-2.1269531,3.2167969l11.5078125-0.4804688l-3.8125-11.1416016    l-2.0917969,3.1494141C18,15.8642578,10.7519531,7.40625,6.8613281,0L6.7045898,7.4560547L0,6.4423828    C9.6123047,18.1318359,16.4091797,23.0361328,24.7314453,28.7373047z"/>
+ </g>
+ <g id="pun_337">
+   <path fill="#FB0F0C" d="M14.3310547,33.3950195l-3.1953125,2.1621094l10.8125,3.9609375l0.7382813-11.7539063    l-3.1347656,2.1074219C13.0302734,18.9287109,9.5698242,8.3349609,8.8081055,0l-3,6.8320313L0,3.3339844    C4.4194336,17.8095703,8.8271484,24.949707,14.3310547,33.3950195z"/>
+ </g>
+ <g id="pun_360">
+   <path fill="#FB0F0C" d="M3.7763672,33.2402344L0,34.0136719l8.4746094,7.8017578l5.1855469-10.5732422l-3.7011719,0.75    C8.1230469,19.3857422,8.9804688,8.2792969,11.4648438,0.2900391L6.0834961,5.4580078L2.0581055,0    C0.5874023,15.0527344,1.9291992,23.3261719,3.7763672,33.2402344z"/>
+ </g>
+ <g id="pun_45">
+   <path fill="#FB0F0C" d="M3.2211914,24.7319336L0,22.6049805l0.4804688,11.5117188l11.1445313-3.8125L8.4755859,28.206543    c7.612793-10.2089844,16.0737305-17.4575195,23.4741211-21.3510742L24.496582,6.703125L25.5102539,0    C13.8208008,9.6123047,8.9223633,16.4121094,3.2211914,24.7319336z"/>
+ </g>
+ <g id="pun_67">
+   <path fill="#FB0F0C" d="M6.1230469,14.3266602l-2.1635742-3.1967773L0,21.9438477l11.7539063,0.7441406l-2.109375-3.1445313    c10.9462891-6.5214844,21.5380859-9.9780273,29.8662109-10.7368164l-6.828125-2.9970703L36.1865234,0    C21.7041016,4.4150391,14.5737305,8.8242188,6.1230469,14.3266602z"/>
+ </g>
+ <g id="pun_90">
+   <path fill="#FB0F0C" d="M8.5737305,3.7822266L7.7988281,0L0,8.4814453l10.574707,5.1855469L9.8276367,9.9580078    c12.6069336-1.8339844,23.7124023-0.9755859,31.6987305,1.5058594l-5.1679688-5.3818359l5.4609375-4.0224609    C26.7607422,0.5888672,18.4848633,1.9365234,8.5737305,3.7822266z"/>
+ </g>
+ <g id="sin_112">
+   <path fill="#209BBB" d="M9.7177734,3.7929688L10.4501953,0L0,4.8476563l7.7900391,8.8359375L8.5166016,9.96875    c12.3486328,3.1289063,22.2768555,8.1738281,28.7104492,13.5273438l-2.703125-6.9472656l6.5761719-1.6289063    C27.7446289,7.8007813,19.5849609,5.8789063,9.7177734,3.7929688z"/>
+ </g>
+ <g id="sin_135">
+   <path fill="#209BBB" d="M9.3867188,3.2226563L11.5107422,0L0,0.4804688L3.8144531,11.625l2.0888672-3.1523438    c10.2128906,7.6171875,17.4609375,16.0761719,21.3515625,23.484375l0.1582031-7.4589844l6.703125,1.0175781    C24.5009766,13.8222656,17.7041016,8.9238281,9.3867188,3.2226563z"/>
+ </g>
+ <g id="sin_157">
+   <path fill="#209BBB" d="M8.3613281,6.1230469l3.1992188-2.1679688L0.7441406,0L0,11.7539063l3.140625-2.109375    c6.5244141,10.9375,9.9780273,21.5371094,10.7397461,29.8652344l3-6.828125l5.8105469,3.4980469    C18.2729492,21.7011719,13.862793,14.5722656,8.3613281,6.1230469z"/>
+ </g>
+ <g id="sin_180">
+   <path fill="#209BBB" d="M9.8789063,8.578125l3.7763672-0.7792969L5.1855469,0L0,10.5761719l3.7089844-0.75    c1.8310547,12.6074219,0.9755859,23.7128906-1.5146484,31.6992188l5.3847656-5.1640625l4.0253906,5.4550781    C13.0693359,26.765625,11.7333984,18.4921875,9.8789063,8.578125z"/>
+ </g>
+ <g id="sin_202">
+   <path fill="#209BBB" d="M19.7050781,9.7197266l3.7939453,0.7265625L18.6533203,0L9.8144531,7.7890625l3.7119141,0.7246094    C10.4003906,20.8652344,5.3554688,30.8051758,0,37.230957l6.9550781-2.7128906l1.6289063,6.578125    C15.6943359,27.7446289,17.6220703,19.5869141,19.7050781,9.7197266z"/>
+ </g>
+ <g id="sin_22">
+   <path fill="#209BBB" d="M3.7910156,31.3793945L0,30.6469727L4.8486328,41.090332l8.8300781-7.7871094l-3.703125-0.7265625    c3.1259766-12.3442383,8.1708984-22.2832031,13.5205078-28.706543l-6.9433594,2.7084961L14.9179688,0    C7.7988281,13.3535156,5.8769531,21.512207,3.7910156,31.3793945z"/>
+ </g>
+ <g id="sin_225">
+   <path fill="#209BBB" d="M28.7373047,9.3837891l3.2226563,2.1240234L31.4794922,0L20.3349609,3.8129883l3.1523438,2.0917969    C15.8701172,16.1132813,7.4091797,23.3652344,0,27.2558594l7.4619141,0.1523438l-1.0166016,6.7089844    C18.1347656,24.4980469,23.0390625,17.703125,28.7373047,9.3837891z"/>
+ </g>
+ <g id="sin_247">
+   <path fill="#209BBB" d="M33.3955078,8.362793l2.1621094,3.1889648l3.9609375-10.8120117L27.7587891,0l2.1152344,3.1376953    C18.9287109,9.65625,8.3320313,13.1147461,0,13.8754883l6.8291016,2.9951172l-3.4980469,5.8125    C17.8095703,18.2700195,24.9404297,13.8647461,33.3955078,8.362793z"/>
+ </g>
+ <g id="sin_270">
+   <path fill="#209BBB" d="M33.2431641,9.8842773l0.7763672,3.7773438l7.7988281-8.4775391L31.2421875,0l0.7441406,3.7016602    C19.3886719,5.5341797,8.2792969,4.6787109,0.2929688,2.1928711l5.1621094,5.3847656L0,11.6030273    C15.0556641,13.0708008,23.3320313,11.7319336,33.2431641,9.8842773z"/>
+ </g>
+ <g id="sin_292">
+   <path fill="#209BBB" d="M31.3862305,19.706543l-0.7265625,3.7861328l10.4414063-4.8417969L33.3139648,9.815918    l-0.7265625,3.7080078C20.2382813,10.3945313,10.3037109,5.3481445,3.8730469,0l2.7099609,6.9448242L0,8.5737305    C13.3623047,15.6928711,21.5214844,17.6196289,31.3862305,19.706543z"/>
+ </g>
+ <g id="sin_315">
+   <path fill="#209BBB" d="M24.7294922,28.7387695l-2.1240234,3.2167969l11.5078125-0.4804688l-3.8115234-11.1416016    l-2.0917969,3.1494141C18,15.8657227,10.7519531,7.40625,6.8613281,0L6.7060547,7.4575195L0,6.4438477    C9.6123047,18.1313477,16.4091797,23.0356445,24.7294922,28.7387695z"/>
+ </g>
+ <g id="sin_337">
+   <path fill="#209BBB" d="M14.3291016,33.3925781l-3.1933594,2.1621094l10.8134766,3.9609375L22.6875,27.7617188    l-3.1347656,2.1064453C13.03125,18.9257813,9.5712891,8.3305664,8.8095703,0l-3,6.8276367L0,3.3295898    C4.4208984,17.8066406,8.8271484,24.9423828,14.3291016,33.3925781z"/>
+ </g>
+ <g id="sin_360">
+   <path fill="#209BBB" d="M3.7763672,33.2402344L0,34.0136719l8.4755859,7.7998047l5.1826172-10.5712891l-3.6972656,0.75    C8.1240234,19.3857422,8.9824219,8.2763672,11.4667969,0.2885742L6.0849609,5.4536133L2.0595703,0    C0.5888672,15.0512695,1.9306641,23.3251953,3.7763672,33.2402344z"/>
+ </g>
+ <g id="sin_45">
+   <path fill="#209BBB" d="M3.2226563,24.7299805L0,22.6030273L0.4804688,34.112793L11.625,30.2983398L8.4755859,28.206543    c7.6142578-10.2089844,16.0751953-17.4575195,23.4755859-21.3481445l-7.453125-0.1523438L25.5117188,0    C13.8222656,9.609375,8.9238281,16.4121094,3.2226563,24.7299805z"/>
+ </g>
+ <g id="sin_67">
+   <path fill="#209BBB" d="M6.1230469,14.331543l-2.1650391-3.1987305L0,21.9487305l11.7539063,0.7441406l-2.109375-3.140625    c10.9453125-6.5273438,21.5302734-9.9838867,29.8652344-10.7426758L32.6806641,5.8125L36.1845703,0    C21.703125,4.4179688,14.5722656,8.8271484,6.1230469,14.331543z"/>
+ </g>
+ <g id="sin_90">
+   <path fill="#209BBB" d="M8.5737305,3.7822266L7.800293,0L0,8.4819336l10.574707,5.1855469L9.8276367,9.9584961    c12.6049805-1.8339844,23.7084961-0.9765625,31.6948242,1.5058594l-5.1621094-5.3823242l5.4609375-4.0224609    C26.7597656,0.5888672,18.4892578,1.9365234,8.5737305,3.7822266z"/>
+ </g>
+ <g id="viol_112">
+   <path fill="#AE137A" d="M9.7177734,3.7910156L10.4501953,0L0,4.8457031l7.7915039,8.8359375l0.7265625-3.7119141    c12.347168,3.1259766,22.2773438,8.1708984,28.7109375,13.5263672l-2.7041016-6.9462891l6.5771484-1.6289063    C27.7426758,7.8017578,19.5849609,5.8798828,9.7177734,3.7910156z"/>
+ </g>
+ <g id="viol_135">
+   <path fill="#AE137A" d="M9.3867188,3.2226563L11.5107422,0L0,0.4804688L3.8129883,11.625l2.090332-3.1494141    C16.1162109,16.0898438,23.359375,24.5478516,27.25,31.9570313l0.1582031-7.4589844l6.703125,1.0166016    C24.5019531,13.8193359,17.7050781,8.9238281,9.3867188,3.2226563z"/>
+ </g>
+ <g id="viol_157">
+   <path fill="#AE137A" d="M8.3613281,6.1210938l3.1977539-2.1621094L0.7441406,0L0,11.7578125l3.140625-2.1132813    c6.5229492,10.9394531,9.9804688,21.5371094,10.7421875,29.8642578l2.9941406-6.8271484l5.8085938,3.4990234    C18.2792969,21.7011719,13.8652344,14.5722656,8.3613281,6.1210938z"/>
+ </g>
+ <g id="viol_180">
+   <path fill="#AE137A" d="M9.8789063,8.578125l3.7792969-0.7763672L5.1870117,0L0,10.5761719l3.7089844-0.75    c1.8325195,12.6064453,0.9770508,23.7158203-1.5131836,31.7021484l5.3842773-5.1650391l4.0244141,5.4521484    C13.0722656,26.7626953,11.7333984,18.4921875,9.8789063,8.578125z"/>
+ </g>
+ <g id="viol_202">
+   <path fill="#AE137A" d="M19.7055664,9.7177734l3.7929688,0.7265625L18.6567383,0l-8.84375,7.7871094l3.7148438,0.7265625    C10.4018555,20.8652344,5.3554688,30.8027344,0,37.2304688l6.9536133-2.7128906l1.6289063,6.5771484    C15.6977539,27.7441406,17.6196289,19.5849609,19.7055664,9.7177734z"/>
+ </g>
+ <g id="viol_22">
+   <path fill="#AE137A" d="M3.7924805,31.3769531L0,30.6533203l4.8486328,10.4443359l8.831543-7.7900391l-3.7045898-0.7324219    c3.1245117-12.3427734,8.1723633-22.2802734,13.519043-28.7050781l-6.9404297,2.7128906L14.9194336,0    C7.800293,13.3535156,5.8769531,21.5126953,3.7924805,31.3769531z"/>
+ </g>
+ <g id="viol_225">
+   <path fill="#AE137A" d="M28.7387695,9.3828125l3.2226563,2.125L31.480957,0L20.3364258,3.8144531l3.1523438,2.0878906    C15.8701172,16.109375,7.4106445,23.3613281,0,27.2539063L7.4619141,27.40625l-1.0151367,6.7070313    C18.1352539,24.4921875,23.0405273,17.7011719,28.7387695,9.3828125z"/>
+ </g>
+ <g id="viol_247">
+   <path fill="#AE137A" d="M33.3955078,8.3642578l2.1621094,3.190918l3.9609375-10.8139648L27.7587891,0l2.1152344,3.140625    C18.9301758,9.6591797,8.3334961,13.1157227,0,13.8754883l6.8305664,3l-3.4980469,5.8125    C17.8110352,18.2758789,24.9404297,13.8657227,33.3955078,8.3642578z"/>
+ </g>
+ <g id="viol_270">
+   <path fill="#AE137A" d="M33.2451172,9.8813477l0.7734375,3.7792969l7.8007813-8.4750977L31.2431641,0l0.7441406,3.703125    C19.3886719,5.5341797,8.2792969,4.6787109,0.2929688,2.1943359L5.456543,7.5786133L0,11.6040039    C15.0556641,13.0727539,23.3330078,11.730957,33.2451172,9.8813477z"/>
+ </g>
+ <g id="viol_292">
+   <path fill="#AE137A" d="M31.3862305,19.7055664l-0.7265625,3.7851563l10.4414063-4.84375l-7.7871094-8.8295898    l-0.7265625,3.706543C20.2382813,10.3945313,10.3022461,5.3496094,3.8730469,0l2.7099609,6.9462891L0,8.5751953    C13.3623047,15.6938477,21.5200195,17.6196289,31.3862305,19.7055664z"/>
+ </g>
+ <g id="viol_315">
+   <path fill="#AE137A" d="M24.7304688,28.7373047l-2.1210938,3.2167969l11.5078125-0.4804688l-3.8144531-11.1416016    l-2.0917969,3.1494141C18,15.8642578,10.7519531,7.40625,6.8613281,0L6.7045898,7.4560547L0,6.4423828    C9.6152344,18.1318359,16.4121094,23.0361328,24.7304688,28.7373047z"/>
+ </g>
+ <g id="viol_337">
+   <path fill="#AE137A" d="M14.3251953,33.3896484l-3.1894531,2.1621094l10.8125,3.9609375l0.7382813-11.7539063    l-3.1347656,2.1064453C13.0302734,18.9257813,9.5698242,8.3291016,8.8081055,0l-3,6.8291016L0,3.3310547    C4.4223633,17.8066406,8.8256836,24.9433594,14.3251953,33.3896484z"/>
+ </g>
+ <g id="viol_360">
+   <path fill="#AE137A" d="M3.7763672,33.2402344L0,34.0136719l8.4736328,7.8017578l5.1855469-10.5732422l-3.6992188,0.75    C8.1220703,19.3857422,8.9814453,8.2763672,11.4658203,0.2900391L6.0834961,5.4550781L2.0581055,0    C0.5874023,15.0527344,1.9291992,23.3261719,3.7763672,33.2402344z"/>
+ </g>
+ <g id="viol_45">
+   <path fill="#AE137A" d="M3.2211914,24.7290039L0,22.6020508l0.4804688,11.5117188l11.1445313-3.8125l-3.1494141-2.09375    c7.612793-10.2109375,16.0742188-17.4584961,23.4746094-21.3491211l-7.453125-0.1523438L25.5107422,0    C13.8208008,9.609375,8.9223633,16.4150391,3.2211914,24.7290039z"/>
+ </g>
+ <g id="viol_67">
+   <path fill="#AE137A" d="M6.1230469,14.3261719l-2.1635742-3.1962891L0,21.9462891l11.7539063,0.7441406l-2.109375-3.140625    c10.9467773-6.5244141,21.5371094-9.9814453,29.8671875-10.7431641l-6.8300781-2.9970703L36.1855469,0    C21.7050781,4.4150391,14.5737305,8.8212891,6.1230469,14.3261719z"/>
+ </g>
+ <g id="viol_90">
+   <path fill="#AE137A" d="M8.5737305,3.7851563L7.800293,0L0,8.4819336l10.574707,5.1816406L9.8276367,9.9545898    c12.6054688-1.8300781,23.7089844-0.9746094,31.6953125,1.5058594l-5.1621094-5.378418l5.4550781-4.0224609    C26.7592773,0.5888672,18.4892578,1.9335938,8.5737305,3.7851563z"/>
+ </g>
+
+
+ <g id="H">
+   <g>
+			<path transform="translate(-20,-20)" d="M7.7275391,20.4018555v16.5888672H0V0h7.7275391v14.0136719h14.4257813V0h7.7285156v36.9907227h-7.7285156V20.4018555     H7.7275391z"/>
+		</g>
+ </g>
+ <g id="Jaatavasade">
+   <g>
+			<path fill="#231F20" d="M32.8007813,15.0234375c-10.0078125,0-14.0336914-12.5292969-22.7080078-12.5292969     c-3.828125,0-7.5693359,2.75-7.5693359,6.8046875c0,1.0205078,0.7080078,1.9550781,0.7080078,2.8632813     c0,0.6796875-0.5664063,1.2480469-1.246582,1.2480469C0.3964844,13.4101563,0,10.546875,0,9.3554688     C0,3.8837891,4.8476563,0,10.0927734,0c10.0073242,0,14.0341797,12.53125,22.7080078,12.53125     c3.8261719,0,7.5703125-2.7519531,7.5703125-6.8046875c0-1.1054688-0.7382813-2.1816406-0.7382813-2.8632813     s0.5957031-1.2480469,1.2753906-1.2480469c1.6171875,0,1.9570313,2.8349609,1.9570313,4.0527344     C42.8652344,11.1425781,38.0742188,15.0234375,32.8007813,15.0234375z M10.234375,13.4375     c-1.9570313,0-3.5717773-1.6171875-3.5717773-3.5722656c0-1.984375,1.5869141-3.6015625,3.5717773-3.6015625     c1.7861328,0,3.5996094,1.8144531,3.5996094,3.6015625C13.8339844,11.8496094,12.2177734,13.4375,10.234375,13.4375z"/>
+		</g>
+ </g>
+ <g id="Jaatavatihku">
+   <g>
+			<g>
+				<path fill="#231F20" d="M11.7949219,13.5546875c-0.2714844,0.03125-0.5410156,0.0488281-0.8105469,0.0488281      c-1.7885742,0-2.7504883-1.1953125-2.7504883-2.9179688c0-2.0258789,1.2661133-3.0375977,3.2226563-3.0375977      c2.0249023,0,2.9702148,1.3828125,2.9702148,3.2895508c0,3.0722656-2.4462891,5.2832031-4.6240234,7.0878906      l-0.6240234-0.640625C10.1904297,16.3046875,11.3051758,14.9707031,11.7949219,13.5546875z"/>
+			</g>
+			<g>
+				<path fill="#231F20" d="M32.8022461,15.0253906c-10.0097656,0-14.034668-12.5302734-22.7094727-12.5302734      c-3.828125,0-7.5693359,2.7490234-7.5693359,6.8041992c0,1.0209961,0.7080078,1.956543,0.7080078,2.8647461      c0,0.6777344-0.5664063,1.2460938-1.2460938,1.2460938C0.3969727,13.4101563,0,10.546875,0,9.3554688      C0,3.8842773,4.8476563,0,10.0927734,0c10.0078125,0,14.0317383,12.53125,22.7094727,12.53125      c3.8242188,0,7.5683594-2.7504883,7.5683594-6.8051758c0-1.1044922-0.7382813-2.1826172-0.7382813-2.8623047      c0-0.6811523,0.5957031-1.2475586,1.2773438-1.2475586c1.6152344,0,1.9550781,2.8344727,1.9550781,4.0541992      C42.8647461,11.1425781,38.0717773,15.0253906,32.8022461,15.0253906z M10.234375,13.4375      c-1.956543,0-3.5712891-1.6152344-3.5712891-3.5722656c0-1.984375,1.5869141-3.5991211,3.5712891-3.5991211      c1.7861328,0,3.6000977,1.8134766,3.6000977,3.5991211C13.8344727,11.8515625,12.2182617,13.4375,10.234375,13.4375z"/>
+			</g>
+		</g>
+ </g>
+ <g id="K">
+   <g>
+			<path transform="translate(-20,-20)" d="M7.7280273,36.9912109H0V0h7.7280273v15.0439453L21.8442383,0h9.9951172L16.7426758,15.1464844L32.715332,36.9912109     h-9.9443359L11.3344727,20.7617188l-3.6064453,3.7099609V36.9912109z"/>
+		</g>
+ </g>
+ <g id="L">
+   <g>
+			<path transform="translate(-20,-20)" d="M7.7270508,30.2949219h18.394043v6.6972656H0V0h7.7270508V30.2949219z"/>
+		</g>
+ </g>
+ <g id="Lumi1">
+   <g>
+			<path fill="#1B8BBA" stroke="#1B8BBA" stroke-width="0.4252" stroke-linecap="round" d="M7.9711914,6.9858398     l4.8632813-2.8076172l-0.7207031-1.2460938L7.2631836,5.7333984V0.2124023H5.824707v5.5380859L1.0200195,2.9746094     L0.300293,4.2197266l4.7949219,2.7661133L0.2905273,9.762207l0.7177734,1.2441406L5.824707,8.2231445v5.6445313h1.4384766     V8.2387695l4.8632813,2.8066406l0.7177734-1.2441406L7.9711914,6.9858398z"/>
+		</g>
+ </g>
+ <g id="Lumikuuro">
+   <g>
+			<path fill="#FFFFFF" stroke="#666666" d="M31.8208008,19.8842773L16.347168,46.2368164L0.8735352,19.8842773H31.8208008z"/>
+			<path fill="#1B8BBA device-cmyk(0.85,0.25,0,0.27)" stroke="#1B8BBA" stroke-width="0.4252" stroke-linecap="round" d="M18.0952148,6.9863281     l4.8632813-2.8076172l-0.7177734-1.246582L17.387207,5.7348633V0.2124023h-1.4355469v5.5385742l-4.8046875-2.7758789     l-0.7226563,1.2441406l4.7949219,2.7670898l-4.8046875,2.7749023l0.7177734,1.2460938l4.8193359-2.7822266v5.6435547h1.4355469     V8.2387695l4.8632813,2.8076172l0.7177734-1.2441406L18.0952148,6.9863281z"/>
+		</g>
+ </g>
+ <g id="M">
+   <g>
+			<path transform="translate(-20,-20)" d="M35.8583984,36.9912109h-7.2138672V6.0791016h-0.1015625l-6.9042969,30.9121094h-7.5737305L7.3154297,6.0791016     H7.2128906v30.9121094H0V0h11.2832031l6.6972656,29.1601563h0.1035156L24.6777344,0h11.1806641V36.9912109z"/>
+		</g>
+ </g>
+ <g id="Rantakuuro">
+   <g>
+			<path fill="#1B8BBA" d="M16.0981445,0l4.4824219,8.4072266c1.6552734,3.8564453-0.7568359,7.5634766-4.5117188,7.5634766     S9.4868164,11.921875,11.762207,8.0615234L16.0981445,0z"/>
+			<path fill="#FFFFFF" stroke="#808285" d="M31.8208008,31.6582031L16.347168,58.0107422L0.8735352,31.6582031H31.8208008z"/>
+			<g>
+				<path fill="#1B8BBA" stroke="#1B8BBA" stroke-width="0.4252" stroke-linecap="round" d="M17.7241211,23.9658203      l4.8632813-2.8076172l-0.7177734-1.246582l-4.8535156,2.8027344v-5.5224609h-1.4355469v5.5385742l-4.8046875-2.7763672      l-0.7226563,1.2441406l4.7949219,2.7675781l-4.8046875,2.7744141l0.7177734,1.2460938l4.8193359-2.7817383v5.6430664h1.4355469      v-5.6298828l4.8632813,2.8076172l0.7177734-1.2436523L17.7241211,23.9658203z"/>
+			</g>
+		</g>
+ </g>
+ <g id="Sumu">
+   <g>
+			<path fill="none" stroke="#939598" stroke-width="4" stroke-dasharray="4 1.5" d="M0,2h39.6699219"/>
+			<path fill="none" stroke="#939598" stroke-width="4" stroke-dasharray="4 1.5" d="M6.25,14.0415039h39.6699219"/>
+			<path fill="none" stroke="#939598" stroke-width="4" stroke-dasharray="4 1.5" d="M0,26.0844727h39.6699219"/>
+		</g>
+ </g>
+ <g id="Ukkonen">
+			<path fill="#231F20" d="M22.3408203,31.824707c-2.734375-4.0087891-8.2294922-12.0703125-9.3193359-13.6669922
+                        C14.8164063,16.2524414,30.1210938,0,30.1210938,0H25.78125H0v38.1235352h3.75c0,0,0-31.0019531,0-34.3735352
+                        c2.5585938,0,12.4316406,0,17.6894531,0C17.5947266,7.8320313,8.2265625,17.7807617,8.2265625,17.7807617l11.0058594,16.1435547
+                        l-6.2207031-1.1767578l3.0400391,4.4580078l8.8378906,1.6699219l1.6699219-8.8378906l-3.0371094-4.4580078L22.3408203,31.824707z"
+                        />
+ </g>
+ <g id="Vesi1">
+   <g>
+			<path fill="#1B8BBA" d="M5.1503906,0l4.4824219,8.4067383c1.6533203,3.8564453-0.7587891,7.5634766-4.5117188,7.5634766     c-3.7539063,0-6.5820313-4.0488281-4.3066406-7.9086914L5.1503906,0z"/>
+		</g>
+ </g>
+ <g id="Vesikuuro">
+   <g>
+			<path fill="#FFFFFF" stroke="#666666" d="M31.8154297,0.5L16.3447266,26.8520508L0.8735352,0.5H31.8154297z"/>
+		</g>
+ </g>
+
+   
+ <!-- *** CUSTOMER SPECIFIC FIXED PART ENDS *** -->
+
+ <!-- *** actual weather paths from WOML data *** -->
+
+ --PATHS--
+
+ <!-- *** masks for all rain objects *** -->
+
+ --MASKS--
+
+
+
+</defs>
+
+<!-- *** ACTUAL GRAPH OBJECTS START -->
+
+
+
+<!-- weather begins -->
+
+<g id="contourlines" class="weather">
+ --PRESSURELINES--
+ --PRESSURELABELS--
+</g>
+
+
+<g id="weather1" class="weather">
+<clipPath id="precipitationMask">
+--PRECIPITATIONAREAS--
+</clipPath>
+</g>
+
+<g id="precipitationLayer"
+   style="clip-path:url(#precipitationMask);">
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="0" y1="0" x2="623.619" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-5.67" y1="0" x2="617.95" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-11.339" y1="0" x2="612.281" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-17.009" y1="0" x2="606.612" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-22.678" y1="0" x2="600.943" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-28.348" y1="0" x2="595.274" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-34.017" y1="0" x2="589.605" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-39.687" y1="0" x2="583.937" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-45.356" y1="0" x2="578.268" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-51.025" y1="0" x2="572.599" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-56.695" y1="0" x2="566.93" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-62.364" y1="0" x2="561.261" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-68.034" y1="0" x2="555.592" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-73.703" y1="0" x2="549.923" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-79.373" y1="0" x2="544.254" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-85.042" y1="0" x2="538.585" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-90.711" y1="0" x2="532.916" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-96.381" y1="0" x2="527.247" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-102.05" y1="0" x2="521.578" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-107.72" y1="0" x2="515.909" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-113.389" y1="0" x2="510.24" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-119.059" y1="0" x2="504.571" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-124.728" y1="0" x2="498.902" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-130.397" y1="0" x2="493.233" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-136.067" y1="0" x2="487.564" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-141.736" y1="0" x2="481.896" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-147.406" y1="0" x2="476.227" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-153.075" y1="0" x2="470.558" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-158.745" y1="0" x2="464.889" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-164.414" y1="0" x2="459.22" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-170.083" y1="0" x2="453.551" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-175.753" y1="0" x2="447.882" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-181.422" y1="0" x2="442.213" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-187.092" y1="0" x2="436.544" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-192.761" y1="0" x2="430.875" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-198.431" y1="0" x2="425.206" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-204.1" y1="0" x2="419.537" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-209.77" y1="0" x2="413.868" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-215.439" y1="0" x2="408.199" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-221.108" y1="0" x2="402.53" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-226.778" y1="0" x2="396.861" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-232.447" y1="0" x2="391.192" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-238.117" y1="0" x2="385.523" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-243.786" y1="0" x2="379.854" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-249.456" y1="0" x2="374.186" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-255.125" y1="0" x2="368.517" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-260.794" y1="0" x2="362.848" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-266.464" y1="0" x2="357.179" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-272.133" y1="0" x2="351.51" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-277.803" y1="0" x2="345.841" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-283.472" y1="0" x2="340.172" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-289.142" y1="0" x2="334.503" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-294.811" y1="0" x2="328.834" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-300.48" y1="0" x2="323.165" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-306.15" y1="0" x2="317.496" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-311.819" y1="0" x2="311.827" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-317.489" y1="0" x2="306.157" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-323.158" y1="0" x2="300.488" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-328.828" y1="0" x2="294.818" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-334.497" y1="0" x2="289.149" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-340.167" y1="0" x2="283.479" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-345.836" y1="0" x2="277.81" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-351.505" y1="0" x2="272.141" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-357.175" y1="0" x2="266.471" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-362.844" y1="0" x2="260.802" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-368.514" y1="0" x2="255.132" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-374.183" y1="0" x2="249.463" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-379.853" y1="0" x2="243.793" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-385.522" y1="0" x2="238.124" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-391.191" y1="0" x2="232.455" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-396.861" y1="0" x2="226.785" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-402.53" y1="0" x2="221.116" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-408.2" y1="0" x2="215.446" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-413.869" y1="0" x2="209.777" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-419.539" y1="0" x2="204.107" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-425.208" y1="0" x2="198.438" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-430.877" y1="0" x2="192.769" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-436.547" y1="0" x2="187.099" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-442.216" y1="0" x2="181.43" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-447.886" y1="0" x2="175.76" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-453.555" y1="0" x2="170.091" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-459.225" y1="0" x2="164.421" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-464.894" y1="0" x2="158.752" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-470.563" y1="0" x2="153.083" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-476.233" y1="0" x2="147.413" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-481.902" y1="0" x2="141.744" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-487.572" y1="0" x2="136.074" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-493.241" y1="0" x2="130.405" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-498.911" y1="0" x2="124.735" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-504.58" y1="0" x2="119.066" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-510.25" y1="0" x2="113.396" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-515.919" y1="0" x2="107.727" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-521.588" y1="0" x2="102.058" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-527.258" y1="0" x2="96.388" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-532.927" y1="0" x2="90.719" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-538.597" y1="0" x2="85.049" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-544.266" y1="0" x2="79.38" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-549.936" y1="0" x2="73.71" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-555.605" y1="0" x2="68.041" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-561.274" y1="0" x2="62.372" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-566.944" y1="0" x2="56.702" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-572.613" y1="0" x2="51.033" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-578.283" y1="0" x2="45.363" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-583.952" y1="0" x2="39.694" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-589.622" y1="0" x2="34.024" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-595.291" y1="0" x2="28.355" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-600.96" y1="0" x2="22.686" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-606.63" y1="0" x2="17.016" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-612.299" y1="0" x2="11.347" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="-617.969" y1="0" x2="5.677" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="5.669" y1="0" x2="629.288" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="11.338" y1="0" x2="634.957" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="17.008" y1="0" x2="640.626" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="22.677" y1="0" x2="646.295" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="28.347" y1="0" x2="651.964" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="34.016" y1="0" x2="657.633" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="39.686" y1="0" x2="663.302" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="45.355" y1="0" x2="668.971" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="51.024" y1="0" x2="674.64" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="56.694" y1="0" x2="680.309" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="62.363" y1="0" x2="685.978" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="68.033" y1="0" x2="691.646" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="73.702" y1="0" x2="697.315" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="79.372" y1="0" x2="702.984" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="85.041" y1="0" x2="708.653" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="90.71" y1="0" x2="714.322" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="96.38" y1="0" x2="719.991" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="102.049" y1="0" x2="725.66" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="107.719" y1="0" x2="731.329" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="113.388" y1="0" x2="736.998" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="119.058" y1="0" x2="742.667" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="124.727" y1="0" x2="748.336" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="130.396" y1="0" x2="754.005" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="136.066" y1="0" x2="759.674" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="141.735" y1="0" x2="765.343" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="147.405" y1="0" x2="771.012" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="153.074" y1="0" x2="776.681" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="158.744" y1="0" x2="782.35" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="164.413" y1="0" x2="788.019" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="170.083" y1="0" x2="793.688" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="175.752" y1="0" x2="799.356" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="181.421" y1="0" x2="805.025" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="187.091" y1="0" x2="810.694" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="192.76" y1="0" x2="816.363" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="198.43" y1="0" x2="822.032" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="204.099" y1="0" x2="827.701" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="209.769" y1="0" x2="833.37" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="215.438" y1="0" x2="839.039" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="221.107" y1="0" x2="844.708" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="226.777" y1="0" x2="850.377" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="232.446" y1="0" x2="856.046" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="238.116" y1="0" x2="861.715" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="243.785" y1="0" x2="867.384" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="249.455" y1="0" x2="873.053" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="255.124" y1="0" x2="878.722" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="260.793" y1="0" x2="884.391" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="266.463" y1="0" x2="890.06" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="272.132" y1="0" x2="895.729" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="277.802" y1="0" x2="901.397" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="283.471" y1="0" x2="907.066" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="289.141" y1="0" x2="912.735" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="294.81" y1="0" x2="918.404" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="300.479" y1="0" x2="924.073" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="306.149" y1="0" x2="929.742" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="311.818" y1="0" x2="935.411" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="317.487" y1="0" x2="941.08" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="323.156" y1="0" x2="946.749" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="328.825" y1="0" x2="952.418" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="334.494" y1="0" x2="958.087" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="340.163" y1="0" x2="963.756" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="345.832" y1="0" x2="969.425" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="351.501" y1="0" x2="975.094" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="357.17" y1="0" x2="980.763" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="362.839" y1="0" x2="986.432" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="368.508" y1="0" x2="992.101" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="374.177" y1="0" x2="997.77" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="379.846" y1="0" x2="1003.438" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="385.515" y1="0" x2="1009.107" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="391.184" y1="0" x2="1014.776" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="396.853" y1="0" x2="1020.445" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="402.521" y1="0" x2="1026.114" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="408.19" y1="0" x2="1031.783" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="413.859" y1="0" x2="1037.452" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="419.528" y1="0" x2="1043.121" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="425.197" y1="0" x2="1048.79" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="430.866" y1="0" x2="1054.459" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="436.535" y1="0" x2="1060.128" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="442.204" y1="0" x2="1065.797" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="447.873" y1="0" x2="1071.466" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="453.542" y1="0" x2="1077.135" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="459.211" y1="0" x2="1082.804" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="464.88" y1="0" x2="1088.473" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="470.549" y1="0" x2="1094.142" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="476.218" y1="0" x2="1099.811" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="481.887" y1="0" x2="1105.479" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="487.556" y1="0" x2="1111.148" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="493.225" y1="0" x2="1116.817" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="498.894" y1="0" x2="1122.486" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="504.563" y1="0" x2="1128.155" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="510.231" y1="0" x2="1133.824" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="515.9" y1="0" x2="1139.493" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="521.569" y1="0" x2="1145.162" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="527.238" y1="0" x2="1150.831" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="532.907" y1="0" x2="1156.5" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="538.576" y1="0" x2="1162.169" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="544.245" y1="0" x2="1167.838" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="549.914" y1="0" x2="1173.507" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="555.583" y1="0" x2="1179.176" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="561.252" y1="0" x2="1184.845" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="566.921" y1="0" x2="1190.514" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="572.59" y1="0" x2="1196.183" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="578.259" y1="0" x2="1201.852" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="583.928" y1="0" x2="1207.521" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="589.597" y1="0" x2="1213.189" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="595.266" y1="0" x2="1218.858" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="600.935" y1="0" x2="1224.527" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="606.604" y1="0" x2="1230.196" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="612.272" y1="0" x2="1235.865" y2="623.621"/>
+<line fill="none" stroke="#000000" stroke-width="0.4" x1="617.941" y1="0" x2="1241.534" y2="623.621"/>
+</g>
+
+
+<g id="weather2" class="weather">
+ --COLDFRONTS--
+ --WARMFRONTS--
+ --OCCLUDEDFRONTS--
+ --TROUGHS--
+</g>
+
+<use class="postweather" xlink:href="#weather2"/>
+<g id="weather3" class="weather">
+</g>
+
+<use class="postweather" xlink:href="#weather3"/>
+<g id="weather4" class="weather">
+ --POINTNOTES--
+ --POINTSYMBOLS--
+</g>
+
+ --DEBUGOUTPUT--
+
+
+</svg>